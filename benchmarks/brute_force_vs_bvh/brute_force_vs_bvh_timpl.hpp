@@ -16,6 +16,8 @@
 
 #include <Kokkos_Core.hpp>
 
+#include <algorithm>
+
 #include "brute_force_vs_bvh.hpp"
 
 using ExecutionSpace = Kokkos::DefaultExecutionSpace;
@@ -28,10 +30,31 @@ struct PrimitivesTag
 struct PredicatesTag
 {};
 
+// The coordinates are scaled by 1 / max(nprimitives, nqueries) into the unit
+// cube, where half precision stays finite and has the same relative accuracy
+// for all the problem sizes
 template <int DIM, typename FloatingPoint, typename Tag>
 struct Placeholder
 {
   int count;
+  double scale;
+};
+
+struct IndexOnly
+{
+  template <typename Predicate, typename Value, typename OutputFunctor>
+  KOKKOS_FUNCTION void operator()(Predicate const &, Value const &value,
+                                  OutputFunctor const &out) const
+  {
+    out(value.index);
+  }
+};
+
+// Results of the queries on the host, with sorted indices for each query
+struct Results
+{
+  Kokkos::View<int *, Kokkos::HostSpace> offsets;
+  Kokkos::View<int *, Kokkos::HostSpace> indices;
 };
 } // namespace ArborXBenchmark
 
@@ -50,41 +73,48 @@ struct ArborX::AccessTraits<
 
   static KOKKOS_FUNCTION auto
   get(ArborXBenchmark::Placeholder<DIM, FloatingPoint,
-                                   ArborXBenchmark::PrimitivesTag>,
+                                   ArborXBenchmark::PrimitivesTag>
+          p,
       size_type i)
   {
-    // Primitives are a set of points located at (i, i, i),
+    // Primitives are a set of points located at scale * (i, i, i),
     // with i = 0, ..., n-1
     ArborX::Point<DIM, FloatingPoint> point;
     for (int d = 0; d < DIM; ++d)
-      point[d] = i;
+      point[d] = static_cast<FloatingPoint>(i * p.scale);
     return point;
   }
 
   static KOKKOS_FUNCTION auto
   get(ArborXBenchmark::Placeholder<DIM, FloatingPoint,
-                                   ArborXBenchmark::PredicatesTag>,
+                                   ArborXBenchmark::PredicatesTag>
+          p,
       size_type i)
   {
-    // Predicates are sphere intersections with spheres of radius i
-    // centered at (i, i, i), with i = 0, ..., n-1
+    // Predicates are sphere intersections with spheres of radius scale * i
+    // centered at scale * (i, i, i), with i = 0, ..., n-1
     ArborX::Point<DIM, FloatingPoint> center;
     for (int d = 0; d < DIM; ++d)
-      center[d] = i;
-    return attach(intersects(ArborX::Sphere{center, (FloatingPoint)i}), i);
+      center[d] = static_cast<FloatingPoint>(i * p.scale);
+    return attach(intersects(ArborX::Sphere{
+                      center, static_cast<FloatingPoint>(i * p.scale)}),
+                  i);
   }
 };
 
 namespace ArborXBenchmark
 {
 
+// Returns the results found
 template <int DIM, typename FloatingPoint>
-static void run_fp(int nprimitives, int nqueries, int nrepeats)
+static Results run_fp(int nprimitives, int nqueries, int nrepeats)
 {
   ExecutionSpace space{};
 
-  Placeholder<DIM, FloatingPoint, PrimitivesTag> primitives{nprimitives};
-  Placeholder<DIM, FloatingPoint, PredicatesTag> predicates{nqueries};
+  double const scale = 1. / std::max({nprimitives, nqueries, 1});
+  Placeholder<DIM, FloatingPoint, PrimitivesTag> primitives{nprimitives,
+                                                           scale};
+  Placeholder<DIM, FloatingPoint, PredicatesTag> predicates{nqueries, scale};
   using Point = ArborX::Point<DIM, FloatingPoint>;
 
   for (int i = 0; i < nrepeats; i++)
@@ -121,6 +151,66 @@ static void run_fp(int nprimitives, int nqueries, int nrepeats)
       assert(out_count == values.extent(0));
     }
   }
+
+  // Untimed query identifying the primitives found by each predicate
+  ArborX::BoundingVolumeHierarchy bvh{
+      space, ArborX::Experimental::attach_indices(primitives)};
+  Kokkos::View<int *, ExecutionSpace> indices("Benchmark::indices", 0);
+  Kokkos::View<int *, ExecutionSpace> offsets("Benchmark::offsets", 0);
+  bvh.query(space, predicates, IndexOnly{}, indices, offsets);
+
+  Results results{
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, offsets),
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, indices)};
+  for (int q = 0; q + 1 < (int)results.offsets.size(); ++q)
+    std::sort(results.indices.data() + results.offsets(q),
+              results.indices.data() + results.offsets(q + 1));
+  return results;
+}
+
+// Half-precision coordinates are widened to float for the distance
+// computations, but their storage is rounded. Report the predicates whose
+// results differ from the single precision ones.
+inline void print_accuracy(Results const &results, Results const &reference)
+{
+  int const nqueries = (int)reference.offsets.size() - 1;
+  int mismatched_queries = 0;
+  long long missing = 0;
+  long long extra = 0;
+  for (int q = 0; q < nqueries; ++q)
+  {
+    int i = results.offsets(q);
+    int j = reference.offsets(q);
+    int const i_end = results.offsets(q + 1);
+    int const j_end = reference.offsets(q + 1);
+    long long const missing_before = missing;
+    long long const extra_before = extra;
+    while (i < i_end || j < j_end)
+    {
+      if (j == j_end ||
+          (i < i_end && results.indices(i) < reference.indices(j)))
+      {
+        ++extra;
+        ++i;
+      }
+      else if (i == i_end || reference.indices(j) < results.indices(i))
+      {
+        ++missing;
+        ++j;
+      }
+      else
+      {
+        ++i;
+        ++j;
+      }
+    }
+    if (missing != missing_before || extra != extra_before)
+      ++mismatched_queries;
+  }
+  printf("Results   : %d (float: %d)\n", (int)results.indices.size(),
+         (int)reference.indices.size());
+  printf("Mismatches: %d predicates, %lld missing and %lld extra results\n",
+         mismatched_queries, missing, extra);
 }
 
 template <int DIM>
@@ -133,10 +223,20 @@ void run(int nprimitives, int nqueries, int nrepeats)
 
   printf("-------------------\n");
   printf("Precision : float\n");
-  run_fp<DIM, float>(nprimitives, nqueries, nrepeats);
+  auto const reference = run_fp<DIM, float>(nprimitives, nqueries, nrepeats);
   printf("-------------------\n");
   printf("Precision : double\n");
   run_fp<DIM, double>(nprimitives, nqueries, nrepeats);
+  printf("-------------------\n");
+  printf("Precision : half\n");
+  print_accuracy(run_fp<DIM, Kokkos::Experimental::half_t>(
+                     nprimitives, nqueries, nrepeats),
+                 reference);
+  printf("-------------------\n");
+  printf("Precision : bhalf\n");
+  print_accuracy(run_fp<DIM, Kokkos::Experimental::bhalf_t>(
+                     nprimitives, nqueries, nrepeats),
+                 reference);
 }
 
 } // namespace ArborXBenchmark
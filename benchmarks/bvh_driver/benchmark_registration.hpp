@@ -14,12 +14,15 @@
 
 #include <ArborXBenchmark_PointClouds.hpp>
 #include <ArborX_Point.hpp>
+#include <ArborX_TreeQuality.hpp>
 #include <detail/ArborX_Predicates.hpp>
 
 #include <Kokkos_Core.hpp>
 
 #include <chrono>
 #include <cmath> // cbrt
+#include <type_traits>
+#include <utility>
 
 #include <benchmark/benchmark.h>
 
@@ -216,6 +219,29 @@ struct CountCallback
   }
 };
 
+// Report the quality of the hierarchy next to the rates, so that changes in
+// the query performance can be related to changes in the tree. The effective
+// primitive overlap is only reported for leaves with an extent, as it is
+// always zero for points.
+template <typename ExecutionSpace, typename TreeType>
+void addTreeQualityCounters(benchmark::State &state,
+                            ExecutionSpace const &exec_space,
+                            TreeType const &index)
+{
+  if constexpr (!is_boost_rtree_v<TreeType>)
+  {
+    using Indexable = std::decay_t<decltype(index.indexable_get()(
+        std::declval<typename TreeType::value_type>()))>;
+    auto const quality = ArborX::Experimental::treeQuality(exec_space, index);
+    state.counters["sah"] = quality.sah_cost;
+    if constexpr (!ArborX::GeometryTraits::is_point_v<Indexable>)
+      state.counters["epo"] = quality.epo_cost;
+    state.counters["depth_avg"] = quality.average_leaf_depth;
+    state.counters["depth_max"] = quality.max_leaf_depth;
+    state.counters["overlap"] = quality.sibling_overlap;
+  }
+}
+
 template <typename ExecutionSpace, class TreeType>
 void BM_construction(benchmark::State &state, Spec const &spec)
 {
@@ -241,6 +267,8 @@ void BM_construction(benchmark::State &state, Spec const &spec)
   }
   state.counters["rate"] = benchmark::Counter(
       spec.n_values, benchmark::Counter::kIsIterationInvariantRate);
+  addTreeQualityCounters(state, exec_space,
+                         makeTree<TreeType>(exec_space, points));
 }
 
 template <typename ExecutionSpace, class TreeType>
@@ -278,6 +306,7 @@ void BM_radius_search(benchmark::State &state, Spec const &spec)
   }
   state.counters["rate"] = benchmark::Counter(
       spec.n_queries, benchmark::Counter::kIsIterationInvariantRate);
+  addTreeQualityCounters(state, exec_space, index);
 }
 
 template <typename ExecutionSpace, class TreeType>
@@ -316,6 +345,7 @@ void BM_radius_callback_search(benchmark::State &state, Spec const &spec)
   }
   state.counters["rate"] = benchmark::Counter(
       spec.n_queries, benchmark::Counter::kIsIterationInvariantRate);
+  addTreeQualityCounters(state, exec_space, index);
 }
 
 template <typename ExecutionSpace, class TreeType>
@@ -352,6 +382,7 @@ void BM_knn_search(benchmark::State &state, Spec const &spec)
   }
   state.counters["rate"] = benchmark::Counter(
       spec.n_queries, benchmark::Counter::kIsIterationInvariantRate);
+  addTreeQualityCounters(state, exec_space, index);
 }
 
 template <typename ExecutionSpace, class TreeType>
@@ -390,6 +421,7 @@ void BM_knn_callback_search(benchmark::State &state, Spec const &spec)
   }
   state.counters["rate"] = benchmark::Counter(
       spec.n_queries, benchmark::Counter::kIsIterationInvariantRate);
+  addTreeQualityCounters(state, exec_space, index);
 }
 
 template <typename ExecutionSpace, typename TreeType>
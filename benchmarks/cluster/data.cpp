@@ -10,6 +10,8 @@
  ****************************************************************************/
 #include "data.hpp"
 
+#include <ArborXBenchmark_PointCloudFiles.hpp>
+
 #include <Kokkos_Core.hpp>
 
 #include <fstream>
@@ -46,26 +48,18 @@ INSTANTIATE_MPI_LOADER(6)
 
 int getDataDimension(std::string const &filename, bool binary)
 {
-  std::ifstream input;
-  if (!binary)
-    input.open(filename);
-  else
-    input.open(filename, std::ifstream::binary);
+  if (binary ||
+      pointCloudFileFormat(filename) != PointCloudFileFormat::arborx_binary)
+    return pointCloudFileDimension(filename);
+
+  std::ifstream input(filename);
   if (!input.good())
     throw std::runtime_error("Error reading file \"" + filename + "\"");
 
   int num_points;
   int dim;
-  if (!binary)
-  {
-    input >> num_points;
-    input >> dim;
-  }
-  else
-  {
-    input.read(reinterpret_cast<char *>(&num_points), sizeof(int));
-    input.read(reinterpret_cast<char *>(&dim), sizeof(int));
-  }
+  input >> num_points;
+  input >> dim;
   input.close();
 
   return dim;
@@ -12,6 +12,8 @@
 #ifndef ARBORX_BENCHMARK_DATA_TIMPL_HPP
 #define ARBORX_BENCHMARK_DATA_TIMPL_HPP
 
+#include <ArborXBenchmark_PointCloudFiles.hpp>
+#include <ArborXBenchmark_PointClouds.hpp>
 #include <ArborX_Point.hpp>
 #include <misc/ArborX_Exception.hpp>
 
@@ -372,21 +374,63 @@ template <int DIM, typename MemorySpace>
 Kokkos::View<ArborX::Point<DIM> *, MemorySpace>
 loadData(ArborXBenchmark::Parameters const &params)
 {
+  using ExecutionSpace = typename MemorySpace::execution_space;
+
   if (!params.filename.empty())
   {
+    auto const format = pointCloudFileFormat(params.filename);
+    bool const streamed =
+        (params.binary || format != PointCloudFileFormat::arborx_binary);
+
     // Read in data
     printf("filename          : %s [%s, max_pts = %d]\n",
-           params.filename.c_str(), (params.binary ? "binary" : "text"),
+           params.filename.c_str(),
+           (format == PointCloudFileFormat::ply   ? "ply"
+            : format == PointCloudFileFormat::xyz ? "xyz"
+            : params.binary                       ? "binary"
+                                                  : "text"),
            params.max_num_points);
     printf("samples           : %d\n", params.num_samples);
-    return vec2view<MemorySpace>(loadData<DIM>(params.filename, params.binary,
-                                               params.max_num_points,
-                                               params.num_samples),
-                                 "Benchmark::primitives");
+    if (!streamed)
+      return vec2view<MemorySpace>(loadData<DIM>(params.filename, false,
+                                                 params.max_num_points,
+                                                 params.num_samples),
+                                   "Benchmark::primitives");
+
+    Kokkos::View<ArborX::Point<DIM> *, MemorySpace> points(
+        "Benchmark::primitives", 0);
+    readPointCloud(ExecutionSpace{}, params.filename, points,
+                   params.max_num_points);
+    printf("Read in %d %dD points\n", (int)points.size(), DIM);
+    if (params.num_samples > 0 && params.num_samples < (int)points.size())
+    {
+      auto points_host =
+          Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, points);
+      return vec2view<MemorySpace>(
+          sampleData(std::vector<Point<DIM>>(
+                         points_host.data(),
+                         points_host.data() + points_host.size()),
+                     params.num_samples),
+          "Benchmark::primitives");
+    }
+    return points;
   }
 
   // Generate data
   int dim = params.dim;
+  if (!params.generator.empty() && params.generator != "gantao")
+  {
+    printf("generator         : n = %d, dim = %d, type = %s\n", params.n, dim,
+           params.generator.c_str());
+    Kokkos::View<ArborX::Point<DIM> *, MemorySpace> points(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                           "Benchmark::primitives"),
+        params.n);
+    // Same extent as the data space of the GanTao generator
+    generatePointCloud(ExecutionSpace{},
+                       to_point_cloud_enum(params.generator), 5e5, points);
+    return points;
+  }
   printf("generator         : n = %d, dim = %d, density = %s\n", params.n, dim,
          (params.variable_density ? "variable" : "constant"));
   return vec2view<MemorySpace>(GanTao<DIM>(params.n, params.variable_density),
@@ -269,7 +269,8 @@ int main(int argc, char *argv[])
       ( "core-min-size", bpo::value<int>(&params.core_min_size)->default_value(2), "DBSCAN min_pts")
       ( "dimension", bpo::value<int>(&params.dim)->default_value(-1), "dimension of points to generate" )
       ( "eps", bpo::value<float>(&params.eps), "DBSCAN eps" )
-      ( "filename", bpo::value<std::string>(&params.filename), "filename containing data" )
+      ( "filename", bpo::value<std::string>(&params.filename), "filename containing data (.ply, .xyz, or ArborX format)" )
+      ( "generator", bpo::value<std::string>(&params.generator)->default_value("gantao"), "point generator (gantao | filled_box | hollow_box | filled_sphere | hollow_sphere | gaussian_mixture | fractal | surface)" )
       ( "impl", bpo::value<std::string>(&params.implementation)->default_value("fdbscan"), ("implementation " + vec2string(allowed_impls, " | ")).c_str() )
       ( "labels", bpo::value<std::string>(&params.filename_labels)->default_value(""), "clutering results output" )
       ( "max-num-points", bpo::value<int>(&params.max_num_points)->default_value(-1), "max number of points to read in")
@@ -124,7 +124,8 @@ int main(int argc, char *argv[])
       ( "core-min-size", bpo::value<int>(&params.core_min_size)->default_value(2), "DBSCAN min_pts")
       ( "dendrogram", bpo::value<std::string>(&params.dendrogram)->default_value("boruvka"), ("dendrogram " + vec2string(allowed_dendrograms, " | ")).c_str() )
       ( "dimension", bpo::value<int>(&params.dim)->default_value(-1), "dimension of points to generate" )
-      ( "filename", bpo::value<std::string>(&params.filename), "filename containing data" )
+      ( "filename", bpo::value<std::string>(&params.filename), "filename containing data (.ply, .xyz, or ArborX format)" )
+      ( "generator", bpo::value<std::string>(&params.generator)->default_value("gantao"), "point generator (gantao | filled_box | hollow_box | filled_sphere | hollow_sphere | gaussian_mixture | fractal | surface)" )
       ( "max-num-points", bpo::value<int>(&params.max_num_points)->default_value(-1), "max number of points to read in")
       ( "samples", bpo::value<int>(&params.num_samples)->default_value(-1), "number of samples" )
       ( "variable-density", bpo::bool_switch(&params.variable_density), "type of cluster density to generate" )
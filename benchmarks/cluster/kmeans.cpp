@@ -0,0 +1,147 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+#include <ArborX_KMeans.hpp>
+#include <ArborX_Version.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <iostream>
+
+#include "data.hpp"
+#include "parameters.hpp"
+#include "print_timers.hpp"
+
+template <typename ExecutionSpace, typename Points>
+void run_kmeans(ExecutionSpace const &exec_space, Points const &points,
+                ArborXBenchmark::Parameters const &params)
+{
+  if (params.verbose)
+  {
+    Kokkos::Profiling::Experimental::set_push_region_callback(
+        ArborXBenchmark::push_region);
+    Kokkos::Profiling::Experimental::set_pop_region_callback(
+        ArborXBenchmark::pop_region);
+  }
+
+  using MemorySpace = typename Points::memory_space;
+  using Point = typename Points::value_type;
+
+  Kokkos::View<int *, MemorySpace> labels("Benchmark::labels", 0);
+  Kokkos::View<Point *, MemorySpace> centroids("Benchmark::centroids", 0);
+
+  Kokkos::Profiling::pushRegion("ArborX::KMeans::total");
+  int const num_iterations = ArborX::Experimental::kmeans(
+      exec_space, points, params.num_clusters, labels, centroids,
+      ArborX::Experimental::KMeans::Parameters().setMaxIterations(
+          params.max_iterations));
+  Kokkos::Profiling::popRegion();
+
+  // Sum of the squared distances of the points to their centroid
+  float inertia = 0;
+  Kokkos::parallel_reduce(
+      "Benchmark::inertia", Kokkos::RangePolicy(exec_space, 0, points.size()),
+      KOKKOS_LAMBDA(int i, float &update) {
+        auto const d =
+            ArborX::Details::distance(points(i), centroids(labels(i)));
+        update += d * d;
+      },
+      inertia);
+
+  printf("iterations          : %10d\n", num_iterations);
+  printf("inertia             : %10.3e\n", inertia);
+
+  if (!params.verbose)
+    return;
+
+  printf("-- seeding          : %10.3f\n",
+         ArborXBenchmark::get_time("ArborX::KMeans::seeding"));
+  printf("-- iterations       : %10.3f\n",
+         ArborXBenchmark::get_time("ArborX::KMeans::iterations"));
+  printf("total time          : %10.3f\n",
+         ArborXBenchmark::get_time("ArborX::KMeans::total"));
+}
+
+int main(int argc, char *argv[])
+{
+  Kokkos::ScopeGuard guard(argc, argv);
+
+  using ExecutionSpace = Kokkos::DefaultExecutionSpace;
+  using MemorySpace = ExecutionSpace::memory_space;
+
+  std::cout << "ArborX version    : " << ArborX::version() << std::endl;
+  std::cout << "ArborX hash       : " << ArborX::gitCommitHash() << std::endl;
+  std::cout << "Kokkos version    : " << ArborX::Details::KokkosExt::version()
+            << std::endl;
+
+  namespace bpo = boost::program_options;
+  using namespace ArborXBenchmark;
+
+  Parameters params;
+
+  bpo::options_description desc("Allowed options");
+  // clang-format off
+  desc.add_options()
+      ( "help", "help message" )
+      ( "binary", bpo::bool_switch(&params.binary), "binary file indicator")
+      ( "dimension", bpo::value<int>(&params.dim)->default_value(-1), "dimension of points to generate" )
+      ( "filename", bpo::value<std::string>(&params.filename), "filename containing data (.ply, .xyz, or ArborX format)" )
+      ( "generator", bpo::value<std::string>(&params.generator)->default_value("gantao"), "point generator (gantao | filled_box | hollow_box | filled_sphere | hollow_sphere | gaussian_mixture | fractal | surface)" )
+      ( "max-iterations", bpo::value<int>(&params.max_iterations)->default_value(100), "maximum number of iterations" )
+      ( "max-num-points", bpo::value<int>(&params.max_num_points)->default_value(-1), "max number of points to read in")
+      ( "n", bpo::value<int>(&params.n)->default_value(10), "number of points to generate" )
+      ( "num-clusters", bpo::value<int>(&params.num_clusters)->default_value(16), "number of clusters" )
+      ( "samples", bpo::value<int>(&params.num_samples)->default_value(-1), "number of samples" )
+      ( "variable-density", bpo::bool_switch(&params.variable_density), "type of cluster density to generate" )
+      ( "verbose", bpo::bool_switch(&params.verbose), "verbose")
+      ;
+  // clang-format on
+  bpo::variables_map vm;
+  bpo::store(bpo::command_line_parser(argc, argv).options(desc).run(), vm);
+  bpo::notify(vm);
+
+  if (vm.count("help") > 0)
+  {
+    std::cout << desc << '\n';
+    return 1;
+  }
+
+  // Print out the runtime parameters
+  printf("clusters          : %d\n", params.num_clusters);
+  printf("max iterations    : %d\n", params.max_iterations);
+  printf("verbose           : %s\n", (params.verbose ? "true" : "false"));
+
+  ExecutionSpace exec_space;
+
+  int dim =
+      (params.filename.empty()
+           ? params.dim
+           : ArborXBenchmark::getDataDimension(params.filename, params.binary));
+#define SWITCH_DIM(DIM)                                                        \
+  case DIM:                                                                    \
+    run_kmeans(exec_space,                                                     \
+               ArborXBenchmark::loadData<DIM, MemorySpace>(params), params);   \
+    break;
+  switch (dim)
+  {
+    SWITCH_DIM(2)
+    SWITCH_DIM(3)
+    SWITCH_DIM(4)
+    SWITCH_DIM(5)
+    SWITCH_DIM(6)
+  default:
+    std::cerr << "Error: dimension " << dim << " not allowed\n" << std::endl;
+  }
+#undef SWITCH_DIM
+
+  return 0;
+}
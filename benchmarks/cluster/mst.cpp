@@ -82,7 +82,8 @@ int main(int argc, char *argv[])
       ( "binary", bpo::bool_switch(&params.binary), "binary file indicator")
       ( "core-min-size", bpo::value<int>(&params.core_min_size)->default_value(2), "DBSCAN min_pts")
       ( "dimension", bpo::value<int>(&params.dim)->default_value(-1), "dimension of points to generate" )
-      ( "filename", bpo::value<std::string>(&params.filename), "filename containing data" )
+      ( "filename", bpo::value<std::string>(&params.filename), "filename containing data (.ply, .xyz, or ArborX format)" )
+      ( "generator", bpo::value<std::string>(&params.generator)->default_value("gantao"), "point generator (gantao | filled_box | hollow_box | filled_sphere | hollow_sphere | gaussian_mixture | fractal | surface)" )
       ( "max-num-points", bpo::value<int>(&params.max_num_points)->default_value(-1), "max number of points to read in")
       ( "n", bpo::value<int>(&params.n)->default_value(10), "number of points to generate" )
       ( "samples", bpo::value<int>(&params.num_samples)->default_value(-1), "number of samples" )
@@ -19,7 +19,9 @@ namespace ArborXBenchmark
 struct Parameters
 {
   std::string algorithm;
+  float bandwidth;
   bool binary;
+  bool bin_seeding;
   int cluster_min_size;
   int core_min_size;
   std::string dendrogram;
@@ -27,10 +29,13 @@ struct Parameters
   float eps;
   std::string filename;
   std::string filename_labels;
+  std::string generator;
   std::string implementation;
+  int max_iterations;
   int max_num_points;
   int n;
   int n_seq;
+  int num_clusters;
   int spacing;
   int num_samples;
   bool variable_density;
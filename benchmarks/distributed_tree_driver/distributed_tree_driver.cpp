@@ -9,6 +9,7 @@
  * SPDX-License-Identifier: BSD-3-Clause                                    *
  ****************************************************************************/
 
+#include <ArborXBenchmark_PointClouds.hpp>
 #include <ArborXBenchmark_TimeMonitor.hpp>
 #include <ArborX_DistributedTree.hpp>
 #include <ArborX_Point.hpp>
@@ -46,6 +47,7 @@ int main_(std::vector<std::string> const &args, MPI_Comm const comm)
   bool perform_knn_search = true;
   bool perform_radius_search = true;
   bool shift_queries = false;
+  std::string point_cloud_type;
 
   bpo::options_description desc("Allowed options");
   // clang-format off
@@ -61,6 +63,7 @@ int main_(std::vector<std::string> const &args, MPI_Comm const comm)
         ( "partition_dim", bpo::value<int>(&partition_dim)->default_value(3), "Number of dimension used by the partitioning of the global "
                                                                               "point cloud. 1 -> local clouds are aligned on a line, 2 -> "
                                                                               "local clouds form a board, 3 -> local clouds form a box." )
+        ( "point-cloud-type", bpo::value<std::string>(&point_cloud_type)->default_value("filled_box"), "shape of the local point clouds (filled_box | hollow_box | filled_sphere | hollow_sphere | gaussian_mixture | fractal | surface)." )
         ( "do-not-perform-knn-search", "skip kNN search" )
         ( "do-not-perform-radius-search", "skip radius search" )
         ( "shift-queries" , "By default, points are reused for the queries. Enabling this option shrinks the local box queries are created "
@@ -101,6 +104,7 @@ int main_(std::vector<std::string> const &args, MPI_Comm const comm)
               << "#queries/MPI process    : " << n_queries << '\n'
               << "size of shift           : " << shift << '\n'
               << "dimension               : " << partition_dim << '\n'
+              << "point cloud type        : " << point_cloud_type << '\n'
               << "shift-queries           : " << shift_queries << '\n'
               << '\n';
   }
@@ -176,11 +180,31 @@ int main_(std::vector<std::string> const &args, MPI_Comm const comm)
         Kokkos::view_alloc(Kokkos::WithoutInitializing, "Benchmark::points"),
         std::max(n_values, n_queries));
     auto random_points_host = Kokkos::create_mirror_view(random_points);
-    for (int i = 0; i < random_points.extent_int(0); ++i)
-      random_points_host(i) = {
-          {a * (offset_x + random()),
-           a * (offset_y + random()) * (partition_dim > 1),
-           a * (offset_z + random()) * (partition_dim > 2)}};
+    if (point_cloud_type == "filled_box")
+    {
+      for (int i = 0; i < random_points.extent_int(0); ++i)
+        random_points_host(i) = {
+            {a * (offset_x + random()),
+             a * (offset_y + random()) * (partition_dim > 1),
+             a * (offset_z + random()) * (partition_dim > 2)}};
+    }
+    else
+    {
+      // The other clouds also fit in [-1, 1]^3 and are moved the same way
+      ArborXBenchmark::generatePointCloud(
+          ExecutionSpace{},
+          ArborXBenchmark::to_point_cloud_enum(point_cloud_type), 1.,
+          random_points);
+      Kokkos::deep_copy(random_points_host, random_points);
+      for (int i = 0; i < random_points.extent_int(0); ++i)
+      {
+        auto const p = random_points_host(i);
+        random_points_host(i) = {
+            {a * (offset_x + p[0]),
+             a * (offset_y + p[1]) * (partition_dim > 1),
+             a * (offset_z + p[2]) * (partition_dim > 2)}};
+      }
+    }
     Kokkos::deep_copy(random_points, random_points_host);
 
     Kokkos::deep_copy(
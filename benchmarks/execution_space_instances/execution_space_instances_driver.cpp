@@ -25,14 +25,21 @@
 #include <iostream>
 #include <numeric>
 #include <random>
+#include <thread>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+// Execution space instances partitioning the resources of the default one
+// equally (e.g., the threads of the OpenMP backend)
 template <typename ExecutionSpace>
 class InstanceManager
 {
 public:
-  InstanceManager(int const n_instances) { _instances.resize(n_instances); }
+  InstanceManager(int const n_instances)
+      : _instances(Kokkos::Experimental::partition_space(
+            ExecutionSpace{}, std::vector<int>(n_instances, 1)))
+  {}
   std::vector<ExecutionSpace> const &get_instances() const
   {
     return _instances;
@@ -88,6 +95,64 @@ struct CountCallback
   }
 };
 
+// Whether the instances of a host backend can be dispatched to from several
+// host threads at once. The partitions of Kokkos::Threads share a single
+// thread pool, which does not allow it.
+template <typename ExecutionSpace>
+constexpr bool allowsConcurrentDispatch()
+{
+#ifdef KOKKOS_ENABLE_OPENMP
+  if constexpr (std::is_same_v<ExecutionSpace, Kokkos::OpenMP>)
+    return true;
+#endif
+#ifdef KOKKOS_ENABLE_SERIAL
+  if constexpr (std::is_same_v<ExecutionSpace, Kokkos::Serial>)
+    return true;
+#endif
+  return false;
+}
+
+// Run f(instance, i) for each execution space instance and wait for
+// completion. Kernels on host backends block the calling thread, so that the
+// instances only run concurrently when launched from different host threads,
+// where the backend allows it. Otherwise, they run one after another.
+template <typename ExecutionSpace, typename Function>
+void runConcurrently(std::vector<ExecutionSpace> const &instances,
+                     Function const &f)
+{
+  int const n = instances.size();
+  if constexpr (Kokkos::SpaceAccessibility<ExecutionSpace,
+                                           Kokkos::HostSpace>::accessible &&
+                allowsConcurrentDispatch<ExecutionSpace>())
+  {
+    std::vector<std::thread> threads;
+    threads.reserve(n);
+    for (int i = 0; i < n; ++i)
+      threads.emplace_back([&f, &instances, i] { f(instances[i], i); });
+    for (auto &thread : threads)
+      thread.join();
+  }
+  else
+  {
+    for (int i = 0; i < n; ++i)
+      f(instances[i], i);
+  }
+  for (auto const &instance : instances)
+    instance.fence();
+}
+
+template <typename ExecutionSpace, typename MemorySpace>
+long long totalCount(ExecutionSpace const &space,
+                     Kokkos::View<int *, MemorySpace> const &counts)
+{
+  long long total = 0;
+  Kokkos::parallel_reduce(
+      "Benchmark::total_count", Kokkos::RangePolicy(space, 0, counts.size()),
+      KOKKOS_LAMBDA(int i, long long &update) { update += counts(i); },
+      total);
+  return total;
+}
+
 int main(int argc, char *argv[])
 {
   using ExecutionSpace = Kokkos::DefaultExecutionSpace;
@@ -104,6 +169,8 @@ int main(int argc, char *argv[])
   int num_primitives;
   int num_problems;
   int num_predicates;
+  bool scaling;
+  bool sort_predicates;
 
   bpo::options_description desc("Allowed options");
   // clang-format off
@@ -113,6 +180,8 @@ int main(int argc, char *argv[])
         ( "num-problems", bpo::value<int>(&num_problems)->default_value(1), "Number of subproblems." )
         ( "values", bpo::value<int>(&num_primitives)->default_value(20000), "Number of indexable values (source) per subproblem." )
         ( "queries", bpo::value<int>(&num_predicates)->default_value(5000), "Number of queries (target) per subproblem." )
+        ( "scaling", bpo::bool_switch(&scaling), "Run the queries of all subproblems concurrently on a single tree with 1 to num-spaces instances." )
+        ( "sort-predicates", bpo::bool_switch(&sort_predicates), "Sort the predicates along a space-filling curve." )
         ;
   // clang-format on
   bpo::variables_map vm;
@@ -134,6 +203,8 @@ int main(int argc, char *argv[])
             << "\nnumber of problems                  : " << num_problems
             << "\n#points/problem                     : " << num_primitives
             << "\n#queries/problem                    : " << num_predicates
+            << "\nscaling study                       : " << scaling
+            << "\nsort predicates                     : " << sort_predicates
             << '\n';
 
   // Generate random points uniformly distributed within a box.
@@ -206,31 +277,79 @@ int main(int argc, char *argv[])
   Kokkos::fence();
   Kokkos::Timer query_time;
   query_time.reset();
-  for (int p = 0; p < num_problems; ++p)
-  {
-    auto const &exec_space = instances[p % num_exec_spaces];
-
-    trees[p].query(
-        exec_space,
-        Kokkos::subview(predicates,
-                        Kokkos::pair<int, int>(p * num_predicates,
-                                               (p + 1) * num_predicates)),
-        CountCallback<MemorySpace>{counts},
-        ArborX::Experimental::TraversalPolicy().setPredicateSorting(false));
-    // ArborX::Experimental::TraversalPolicy().setPredicateSorting(true));
-  }
+  runConcurrently(instances, [&](ExecutionSpace const &exec_space, int i) {
+    for (int p = i; p < num_problems; p += num_exec_spaces)
+    {
+      Kokkos::pair<int, int> batch(p * num_predicates,
+                                   (p + 1) * num_predicates);
+      trees[p].query(exec_space, Kokkos::subview(predicates, batch),
+                     CountCallback<MemorySpace>{counts},
+                     ArborX::Experimental::TraversalPolicy()
+                         .setPredicateSorting(sort_predicates));
+    }
+  });
   Kokkos::fence();
   std::cout << "Time multiple(s): " << query_time.seconds() << '\n';
 
   Kokkos::deep_copy(counts, 0);
   query_time.reset();
 
-  tree.query(
-      instances[0], predicates, CountCallback<MemorySpace>{counts},
-      ArborX::Experimental::TraversalPolicy().setPredicateSorting(false));
+  // The default instance uses all the resources
+  tree.query(ExecutionSpace{}, predicates, CountCallback<MemorySpace>{counts},
+             ArborX::Experimental::TraversalPolicy().setPredicateSorting(
+                 sort_predicates));
 
   Kokkos::fence();
   std::cout << "Time single(s): " << query_time.seconds() << '\n';
 
+  if (!scaling)
+    return EXIT_SUCCESS;
+
+  // Split the queries of all subproblems into batches, one per instance, all
+  // traversing the same tree
+  auto const expected_count = totalCount(ExecutionSpace{}, counts);
+  int const n_queries = num_predicates * num_problems;
+
+  std::cout << "\nScaling of concurrent queries on a single tree:\n"
+            << std::setw(10) << "instances" << std::setw(14) << "time(s)"
+            << std::setw(16) << "queries/s" << std::setw(10) << "speedup"
+            << '\n';
+  double reference_time = 0;
+  for (int num_instances = 1; num_instances <= num_exec_spaces;
+       ++num_instances)
+  {
+    InstanceManager<ExecutionSpace> partition_manager(num_instances);
+
+    Kokkos::deep_copy(counts, 0);
+    Kokkos::fence();
+    query_time.reset();
+
+    runConcurrently(
+        partition_manager.get_instances(),
+        [&](ExecutionSpace const &exec_space, int i) {
+          Kokkos::pair<int, int> batch(
+              (long long)n_queries * i / num_instances,
+              (long long)n_queries * (i + 1) / num_instances);
+          tree.query(exec_space, Kokkos::subview(predicates, batch),
+                     CountCallback<MemorySpace>{counts},
+                     ArborX::Experimental::TraversalPolicy()
+                         .setPredicateSorting(sort_predicates));
+        });
+
+    double const time = query_time.seconds();
+    if (num_instances == 1)
+      reference_time = time;
+    std::cout << std::setw(10) << num_instances << std::setw(14) << time
+              << std::setw(16) << n_queries / time << std::setw(10)
+              << reference_time / time << '\n';
+
+    if (totalCount(ExecutionSpace{}, counts) != expected_count)
+    {
+      std::cerr << "Wrong number of results with " << num_instances
+                << " instances\n";
+      return EXIT_FAILURE;
+    }
+  }
+
   return EXIT_SUCCESS;
 }
@@ -0,0 +1,460 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include <ArborX_Box.hpp>
+#include <ArborX_KDOP.hpp>
+#include <ArborX_Point.hpp>
+#include <ArborX_Ray.hpp>
+#include <ArborX_Segment.hpp>
+#include <ArborX_Sphere.hpp>
+#include <ArborX_Triangle.hpp>
+#include <ArborX_Version.hpp>
+#include <algorithms/ArborX_Centroid.hpp>
+#include <algorithms/ArborX_Distance.hpp>
+#include <algorithms/ArborX_Expand.hpp>
+#include <algorithms/ArborX_Intersects.hpp>
+#include <kokkos_ext/ArborX_KokkosExtVersion.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <type_traits>
+
+#include <benchmark/benchmark.h>
+
+using ExecutionSpace = Kokkos::DefaultExecutionSpace;
+using MemorySpace = ExecutionSpace::memory_space;
+
+// Number of (geometry, geometry) pairs processed in each iteration
+constexpr int num_pairs = 1 << 20;
+
+// Extent of the geometries relative to the [-1, 1]^d domain for the kernels
+// that do not depend on the hit rate
+constexpr double default_size = 0.1;
+
+// Random geometries centered in the [-1, 1]^d domain, each one spanning
+// approximately size along every axis
+template <typename Geometry>
+struct GeometryGenerator
+{
+  using Coordinate = ArborX::GeometryTraits::coordinate_type_t<Geometry>;
+  static constexpr int DIM = ArborX::GeometryTraits::dimension_v<Geometry>;
+  using Point = ArborX::Point<DIM, Coordinate>;
+
+  Coordinate _size;
+
+  template <typename Generator>
+  KOKKOS_FUNCTION Point randomPoint(Generator &generator, Point const &center,
+                                    Coordinate radius) const
+  {
+    Point p;
+    for (int d = 0; d < DIM; ++d)
+      p[d] = center[d] + Kokkos::rand<Generator, Coordinate>::draw(
+                             generator, -radius, radius);
+    return p;
+  }
+
+  template <typename Generator>
+  KOKKOS_FUNCTION Geometry operator()(Generator &generator) const
+  {
+    using namespace ArborX::GeometryTraits;
+
+    auto const center = randomPoint(generator, Point{}, 1);
+    Coordinate const half = _size / 2;
+    if constexpr (is_point_v<Geometry>)
+    {
+      return center;
+    }
+    else if constexpr (is_box_v<Geometry>)
+    {
+      Point min_corner;
+      Point max_corner;
+      for (int d = 0; d < DIM; ++d)
+      {
+        auto const h = half * Kokkos::rand<Generator, Coordinate>::draw(
+                                  generator, 0.5, 1.5);
+        min_corner[d] = center[d] - h;
+        max_corner[d] = center[d] + h;
+      }
+      return Geometry{min_corner, max_corner};
+    }
+    else if constexpr (is_sphere_v<Geometry>)
+    {
+      return Geometry{center, half};
+    }
+    else if constexpr (is_triangle_v<Geometry>)
+    {
+      return Geometry{randomPoint(generator, center, half),
+                      randomPoint(generator, center, half),
+                      randomPoint(generator, center, half)};
+    }
+    else if constexpr (is_segment_v<Geometry>)
+    {
+      return Geometry{randomPoint(generator, center, half),
+                      randomPoint(generator, center, half)};
+    }
+    else if constexpr (is_kdop_v<Geometry>)
+    {
+      // Bounding volume of a few random vertices
+      Geometry kdop;
+      for (int k = 0; k <= DIM; ++k)
+        ArborX::Details::expand(kdop, randomPoint(generator, center, half));
+      return kdop;
+    }
+    else
+    {
+      static_assert(is_ray_v<Geometry>);
+      typename Geometry::Vector direction;
+      for (int d = 0; d < DIM; ++d)
+        direction[d] = generator.normal();
+      return Geometry{center, direction};
+    }
+  }
+};
+
+template <typename Geometry>
+std::string geometryName()
+{
+  using namespace ArborX::GeometryTraits;
+
+  if constexpr (is_ray_v<Geometry>)
+    return "Ray";
+  else
+  {
+    std::string name;
+    if constexpr (is_point_v<Geometry>)
+      name = "Point";
+    else if constexpr (is_box_v<Geometry>)
+      name = "Box";
+    else if constexpr (is_sphere_v<Geometry>)
+      name = "Sphere";
+    else if constexpr (is_triangle_v<Geometry>)
+      name = "Triangle";
+    else if constexpr (is_segment_v<Geometry>)
+      name = "Segment";
+    else if constexpr (is_kdop_v<Geometry>)
+      name = "KDOP" + std::to_string(2 * Geometry::n_directions);
+    return name + '<' + std::to_string(dimension_v<Geometry>) + ',' +
+           (std::is_same_v<coordinate_type_t<Geometry>, float> ? "float"
+                                                               : "double") +
+           '>';
+  }
+}
+
+template <typename Geometry>
+auto makeGeometries(ExecutionSpace const &space, int n, double size,
+                    int seed)
+{
+  Kokkos::View<Geometry *, MemorySpace> geometries(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                         "Benchmark::geometries"),
+      n);
+
+  using Coordinate = ArborX::GeometryTraits::coordinate_type_t<Geometry>;
+  GeometryGenerator<Geometry> const generator{(Coordinate)size};
+  Kokkos::Random_XorShift1024_Pool<ExecutionSpace> rand_pool(seed);
+  Kokkos::parallel_for(
+      "Benchmark::generate_geometries", Kokkos::RangePolicy(space, 0, n),
+      KOKKOS_LAMBDA(int i) {
+        auto rand_gen = rand_pool.get_state();
+        geometries(i) = generator(rand_gen);
+        rand_pool.free_state(rand_gen);
+      });
+  return geometries;
+}
+
+template <typename Geometries1, typename Geometries2>
+int countIntersections(ExecutionSpace const &space,
+                       Geometries1 const &geometries1,
+                       Geometries2 const &geometries2)
+{
+  int count = 0;
+  Kokkos::parallel_reduce(
+      "Benchmark::intersects",
+      Kokkos::RangePolicy(space, 0, geometries1.size()),
+      KOKKOS_LAMBDA(int i, int &update) {
+        using ArborX::Details::intersects;
+        if (intersects(geometries1(i), geometries2(i)))
+          ++update;
+      },
+      count);
+  return count;
+}
+
+// Find the size of the geometries for which the given fraction of the pairs
+// intersect, by bisection on a sample
+template <typename Geometry1, typename Geometry2>
+double calibrateSize(ExecutionSpace const &space, double hit_rate)
+{
+  constexpr int num_samples = 1 << 14;
+
+  double lo = 1e-5;
+  double hi = 4;
+  for (int iter = 0; iter < 30; ++iter)
+  {
+    double const size = std::sqrt(lo * hi);
+    int const count = countIntersections(
+        space, makeGeometries<Geometry1>(space, num_samples, size, 3),
+        makeGeometries<Geometry2>(space, num_samples, size, 4));
+    (count < hit_rate * num_samples ? lo : hi) = size;
+  }
+  return std::sqrt(lo * hi);
+}
+
+template <typename Function>
+void timeIterations(benchmark::State &state, Function const &f)
+{
+  ExecutionSpace exec_space;
+  for (auto _ : state)
+  {
+    exec_space.fence();
+    auto const start = std::chrono::high_resolution_clock::now();
+
+    f();
+
+    exec_space.fence();
+    auto const end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed_seconds = end - start;
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Geometry1, typename Geometry2>
+void BM_intersects(benchmark::State &state)
+{
+  ExecutionSpace space;
+  int const n = state.range(0);
+  auto const size =
+      calibrateSize<Geometry1, Geometry2>(space, state.range(1) / 100.);
+  auto const geometries1 = makeGeometries<Geometry1>(space, n, size, 1);
+  auto const geometries2 = makeGeometries<Geometry2>(space, n, size, 2);
+
+  int count = 0;
+  timeIterations(state, [&]() {
+    count = countIntersections(space, geometries1, geometries2);
+  });
+  // Actual hit rate, which may differ from the requested one when the latter
+  // cannot be achieved for the pair of geometries
+  state.counters["hits"] = (double)count / n;
+}
+
+template <typename Geometry1, typename Geometry2>
+void BM_distance(benchmark::State &state)
+{
+  ExecutionSpace space;
+  int const n = state.range(0);
+  auto const geometries1 =
+      makeGeometries<Geometry1>(space, n, default_size, 1);
+  auto const geometries2 =
+      makeGeometries<Geometry2>(space, n, default_size, 2);
+
+  timeIterations(state, [&]() {
+    double sum = 0;
+    Kokkos::parallel_reduce(
+        "Benchmark::distance", Kokkos::RangePolicy(space, 0, n),
+        KOKKOS_LAMBDA(int i, double &update) {
+          using ArborX::Details::distance;
+          update += distance(geometries1(i), geometries2(i));
+        },
+        sum);
+    benchmark::DoNotOptimize(sum);
+  });
+}
+
+template <typename Geometry1, typename Geometry2>
+void BM_expand(benchmark::State &state)
+{
+  ExecutionSpace space;
+  int const n = state.range(0);
+  auto const geometries1 =
+      makeGeometries<Geometry1>(space, n, default_size, 1);
+  auto const geometries2 =
+      makeGeometries<Geometry2>(space, n, default_size, 2);
+  Kokkos::View<Geometry1 *, MemorySpace> expanded(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                         "Benchmark::expanded"),
+      n);
+
+  timeIterations(state, [&]() {
+    Kokkos::parallel_for(
+        "Benchmark::expand", Kokkos::RangePolicy(space, 0, n),
+        KOKKOS_LAMBDA(int i) {
+          auto geometry = geometries1(i);
+          ArborX::Details::expand(geometry, geometries2(i));
+          expanded(i) = geometry;
+        });
+  });
+}
+
+template <typename Geometry>
+void BM_centroid(benchmark::State &state)
+{
+  ExecutionSpace space;
+  int const n = state.range(0);
+  auto const geometries = makeGeometries<Geometry>(space, n, default_size, 1);
+
+  using Coordinate = ArborX::GeometryTraits::coordinate_type_t<Geometry>;
+  constexpr int DIM = ArborX::GeometryTraits::dimension_v<Geometry>;
+  Kokkos::View<ArborX::Point<DIM, Coordinate> *, MemorySpace> centroids(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                         "Benchmark::centroids"),
+      n);
+
+  timeIterations(state, [&]() {
+    Kokkos::parallel_for(
+        "Benchmark::centroid", Kokkos::RangePolicy(space, 0, n),
+        KOKKOS_LAMBDA(int i) {
+          centroids(i) = ArborX::Details::returnCentroid(geometries(i));
+        });
+  });
+}
+
+benchmark::internal::Benchmark *
+registerBenchmark(std::string const &name,
+                  void (*function)(benchmark::State &))
+{
+  return benchmark::RegisterBenchmark(name.c_str(), function)
+      ->UseManualTime()
+      ->Unit(benchmark::kMicrosecond);
+}
+
+template <typename Geometry1, typename Geometry2>
+void registerIntersects()
+{
+  // Hit rates in percent
+  registerBenchmark("intersects/" + geometryName<Geometry1>() + '/' +
+                        geometryName<Geometry2>(),
+                    BM_intersects<Geometry1, Geometry2>)
+      ->ArgsProduct({{num_pairs}, {1, 10, 50}})
+      ->ArgNames({"n", "hit_rate"});
+}
+
+template <typename Geometry1, typename Geometry2>
+void registerDistance()
+{
+  registerBenchmark("distance/" + geometryName<Geometry1>() + '/' +
+                        geometryName<Geometry2>(),
+                    BM_distance<Geometry1, Geometry2>)
+      ->Arg(num_pairs)
+      ->ArgName("n");
+}
+
+template <typename Geometry1, typename Geometry2>
+void registerExpand()
+{
+  registerBenchmark("expand/" + geometryName<Geometry1>() + '/' +
+                        geometryName<Geometry2>(),
+                    BM_expand<Geometry1, Geometry2>)
+      ->Arg(num_pairs)
+      ->ArgName("n");
+}
+
+template <typename Geometry>
+void registerCentroid()
+{
+  registerBenchmark("centroid/" + geometryName<Geometry>(),
+                    BM_centroid<Geometry>)
+      ->Arg(num_pairs)
+      ->ArgName("n");
+}
+
+template <int DIM, typename Coordinate>
+void registerBenchmarks()
+{
+  using Point = ArborX::Point<DIM, Coordinate>;
+  using Box = ArborX::Box<DIM, Coordinate>;
+  using Sphere = ArborX::Sphere<DIM, Coordinate>;
+
+  registerIntersects<Point, Box>();
+  registerIntersects<Box, Box>();
+  registerIntersects<Sphere, Box>();
+  registerIntersects<Point, Sphere>();
+
+  registerDistance<Point, Point>();
+  registerDistance<Point, Box>();
+  registerDistance<Box, Box>();
+  registerDistance<Sphere, Box>();
+  registerDistance<Point, Sphere>();
+
+  registerExpand<Box, Point>();
+  registerExpand<Box, Box>();
+  registerExpand<Box, Sphere>();
+
+  registerCentroid<Box>();
+  registerCentroid<Sphere>();
+
+  if constexpr (DIM == 2 || DIM == 3)
+  {
+    using Triangle = ArborX::Triangle<DIM, Coordinate>;
+    using Segment = ArborX::Experimental::Segment<DIM, Coordinate>;
+    using KDOP = ArborX::Experimental::KDOP<DIM, (DIM == 2 ? 8 : 18),
+                                            Coordinate>;
+
+    if constexpr (DIM == 2)
+    {
+      registerIntersects<Point, Triangle>();
+      registerIntersects<Segment, Box>();
+    }
+    else
+    {
+      registerIntersects<Box, Triangle>();
+    }
+    registerIntersects<Point, KDOP>();
+    registerIntersects<KDOP, Box>();
+    registerIntersects<KDOP, KDOP>();
+
+    registerDistance<Point, Triangle>();
+    registerDistance<Point, Segment>();
+
+    registerExpand<Box, Triangle>();
+    registerExpand<Box, Segment>();
+    registerExpand<KDOP, Point>();
+    registerExpand<KDOP, Box>();
+
+    registerCentroid<Triangle>();
+    registerCentroid<Segment>();
+    registerCentroid<KDOP>();
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  Kokkos::ScopeGuard guard(argc, argv);
+
+  std::cout << "ArborX version    : " << ArborX::version() << std::endl;
+  std::cout << "ArborX hash       : " << ArborX::gitCommitHash() << std::endl;
+  std::cout << "Kokkos version    : " << ArborX::Details::KokkosExt::version()
+            << std::endl;
+
+  benchmark::Initialize(&argc, argv);
+
+  registerBenchmarks<2, float>();
+  registerBenchmarks<3, float>();
+  registerBenchmarks<5, float>();
+  registerBenchmarks<2, double>();
+  registerBenchmarks<3, double>();
+  registerBenchmarks<5, double>();
+
+  // Rays are only implemented in 3D single precision
+  using Ray = ArborX::Experimental::Ray;
+  registerIntersects<Ray, ArborX::Box<3>>();
+  registerIntersects<Ray, ArborX::Triangle<3>>();
+  registerDistance<Ray, ArborX::Box<3>>();
+
+  benchmark::RunSpecifiedBenchmarks();
+
+  return EXIT_SUCCESS;
+}
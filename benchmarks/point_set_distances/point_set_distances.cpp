@@ -0,0 +1,179 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include <ArborX.hpp>
+#include <ArborX_Version.hpp>
+#include <detail/ArborX_PointSetDistances.hpp>
+#include <kokkos_ext/ArborX_KokkosExtVersion.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include <chrono>
+#include <iostream>
+
+#include <benchmark/benchmark.h>
+
+using Point = ArborX::Point<3>;
+
+// Points sampled on the surface of a unit sphere. The second surface is the
+// same sphere with a bumpy radius, so that the two sets are close to each
+// other everywhere, like the two scans of the same object.
+template <typename ExecutionSpace>
+auto sampleSurface(ExecutionSpace const &exec_space, int n, float bump,
+                   int seed)
+{
+  using MemorySpace = typename ExecutionSpace::memory_space;
+  Kokkos::View<Point *, MemorySpace> points(
+      Kokkos::view_alloc(exec_space, Kokkos::WithoutInitializing,
+                         "Benchmark::points"),
+      n);
+
+  Kokkos::Random_XorShift1024_Pool<ExecutionSpace> rand_pool(seed);
+  Kokkos::parallel_for(
+      "Benchmark::sample_surface", Kokkos::RangePolicy(exec_space, 0, n),
+      KOKKOS_LAMBDA(int i) {
+        auto rand_gen = rand_pool.get_state();
+        auto const z = rand_gen.frand(-1.f, 1.f);
+        auto const phi = rand_gen.frand(0.f, 2 * Kokkos::numbers::pi_v<float>);
+        auto const r_xy = Kokkos::sqrt(1 - z * z);
+        auto const radius = 1 + bump * Kokkos::sin(8 * phi) * r_xy;
+        points(i) = {radius * r_xy * Kokkos::cos(phi),
+                     radius * r_xy * Kokkos::sin(phi), radius * z};
+        rand_pool.free_state(rand_gen);
+      });
+  return points;
+}
+
+template <typename Function>
+void timeIterations(benchmark::State &state, Function const &f)
+{
+  Kokkos::DefaultExecutionSpace exec_space;
+  for (auto _ : state)
+  {
+    exec_space.fence();
+    auto const start = std::chrono::high_resolution_clock::now();
+
+    f();
+
+    exec_space.fence();
+    auto const end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed_seconds = end - start;
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+}
+
+void BM_closest_pair(benchmark::State &state)
+{
+  Kokkos::DefaultExecutionSpace exec_space;
+  auto const points1 = sampleSurface(exec_space, state.range(0), 0.f, 1);
+  auto const points2 = sampleSurface(exec_space, state.range(0), 0.05f, 2);
+
+  timeIterations(state, [&]() {
+    benchmark::DoNotOptimize(
+        ArborX::Experimental::closestPair(exec_space, points1, points2));
+  });
+}
+
+void BM_hausdorff(benchmark::State &state)
+{
+  Kokkos::DefaultExecutionSpace exec_space;
+  auto const points1 = sampleSurface(exec_space, state.range(0), 0.f, 1);
+  auto const points2 = sampleSurface(exec_space, state.range(0), 0.05f, 2);
+
+  timeIterations(state, [&]() {
+    benchmark::DoNotOptimize(
+        ArborX::Experimental::hausdorffDistance(exec_space, points1, points2));
+  });
+}
+
+void BM_chamfer(benchmark::State &state)
+{
+  Kokkos::DefaultExecutionSpace exec_space;
+  auto const points1 = sampleSurface(exec_space, state.range(0), 0.f, 1);
+  auto const points2 = sampleSurface(exec_space, state.range(0), 0.05f, 2);
+
+  timeIterations(state, [&]() {
+    benchmark::DoNotOptimize(
+        ArborX::Experimental::chamferDistance(exec_space, points1, points2));
+  });
+}
+
+// Baseline: a nearest neighbor query for every point of the source set,
+// followed by a reduction of the distances
+template <typename ExecutionSpace, typename Points>
+float directedHausdorffNearestQueries(ExecutionSpace const &exec_space,
+                                      Points const &source,
+                                      Points const &target)
+{
+  using MemorySpace = typename ExecutionSpace::memory_space;
+
+  ArborX::BoundingVolumeHierarchy const bvh(
+      exec_space, ArborX::Experimental::attach_indices(target));
+  Kokkos::View<ArborX::PairValueIndex<Point> *, MemorySpace> values(
+      "Benchmark::values", 0);
+  Kokkos::View<int *, MemorySpace> offsets("Benchmark::offsets", 0);
+  bvh.query(exec_space, ArborX::Experimental::make_nearest(source, 1), values,
+            offsets);
+
+  float max = 0;
+  Kokkos::parallel_reduce(
+      "Benchmark::max_distance",
+      Kokkos::RangePolicy(exec_space, 0, source.size()),
+      KOKKOS_LAMBDA(int i, float &update) {
+        auto const d = ArborX::Details::distance(source(i), values(i).value);
+        if (d > update)
+          update = d;
+      },
+      Kokkos::Max<float>(max));
+  return max;
+}
+
+void BM_hausdorff_nearest_queries(benchmark::State &state)
+{
+  Kokkos::DefaultExecutionSpace exec_space;
+  auto const points1 = sampleSurface(exec_space, state.range(0), 0.f, 1);
+  auto const points2 = sampleSurface(exec_space, state.range(0), 0.05f, 2);
+
+  timeIterations(state, [&]() {
+    benchmark::DoNotOptimize(Kokkos::max(
+        directedHausdorffNearestQueries(exec_space, points1, points2),
+        directedHausdorffNearestQueries(exec_space, points2, points1)));
+  });
+}
+
+int main(int argc, char *argv[])
+{
+  Kokkos::ScopeGuard guard(argc, argv);
+
+  std::cout << "ArborX version    : " << ArborX::version() << std::endl;
+  std::cout << "ArborX hash       : " << ArborX::gitCommitHash() << std::endl;
+  std::cout << "Kokkos version    : " << ArborX::Details::KokkosExt::version()
+            << std::endl;
+
+  benchmark::Initialize(&argc, argv);
+
+  for (auto *bm : {benchmark::RegisterBenchmark("closest_pair",
+                                                BM_closest_pair),
+                   benchmark::RegisterBenchmark("hausdorff", BM_hausdorff),
+                   benchmark::RegisterBenchmark("chamfer", BM_chamfer),
+                   benchmark::RegisterBenchmark(
+                       "hausdorff_nearest_queries",
+                       BM_hausdorff_nearest_queries)})
+    bm->RangeMultiplier(10)
+        ->Range(10000, 1000000)
+        ->UseManualTime()
+        ->Unit(benchmark::kMicrosecond);
+
+  benchmark::RunSpecifiedBenchmarks();
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,297 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+// Kokkos Tools library aggregating the profiling regions (ArborX::BVH::BVH,
+// ArborX::DBSCAN::clusters::query, ...) into a tree. For each region, it
+// records the number of calls, the total and self (excluding the nested
+// regions) times, the number of kernels launched and the memory allocated
+// directly within it. The tree is printed when Kokkos is finalized, and is
+// also written as JSON to the file given in the ARBORX_REGION_PROFILER_JSON
+// environment variable, if any.
+//
+// Usage:
+//   ./app --kokkos-tools-libs=libArborX_RegionProfiler.so
+//
+// The times are measured on the host: unless the application fences the
+// execution space, a region only accounts for the launch of the asynchronous
+// kernels it contains.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+struct Region
+{
+  std::string name;
+  int parent;
+  std::map<std::string, int> children;
+  long long calls = 0;
+  double total_time = 0;
+  double children_time = 0;
+  long long kernels = 0;
+  long long allocations = 0;
+  std::uint64_t allocated_bytes = 0;
+};
+
+struct Frame
+{
+  int region;
+  Clock::time_point start;
+};
+
+struct Profile
+{
+  std::mutex mutex;
+  // The first region is the root, which contains everything happening
+  // outside of the profiling regions
+  std::vector<Region> regions;
+  Clock::time_point start;
+  std::int64_t current_bytes = 0;
+  std::int64_t peak_bytes = 0;
+};
+
+Profile profile;
+
+// Regions may be pushed concurrently from different host threads, each one
+// then has its own stack
+thread_local std::vector<Frame> stack;
+
+int currentRegion() { return stack.empty() ? 0 : stack.back().region; }
+
+double seconds(Clock::duration duration)
+{
+  return std::chrono::duration<double>(duration).count();
+}
+
+double selfTime(Region const &region)
+{
+  return region.total_time - region.children_time;
+}
+
+// Regions of the subtree sorted by decreasing total time
+std::vector<int> sortedChildren(Region const &region)
+{
+  std::vector<int> children;
+  for (auto const &child : region.children)
+    children.push_back(child.second);
+  std::sort(children.begin(), children.end(), [](int i, int j) {
+    return profile.regions[i].total_time > profile.regions[j].total_time;
+  });
+  return children;
+}
+
+std::string formatBytes(std::uint64_t bytes)
+{
+  char const *units[] = {"B", "KB", "MB", "GB", "TB"};
+  double value = bytes;
+  int unit = 0;
+  while (value >= 1024 && unit < 4)
+  {
+    value /= 1024;
+    ++unit;
+  }
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%.1f %s", value, units[unit]);
+  return buffer;
+}
+
+void printRegion(std::ostream &os, int index, int depth)
+{
+  auto const &region = profile.regions[index];
+  os << std::setw(8) << region.calls << std::setw(12) << region.total_time
+     << std::setw(12) << selfTime(region) << std::setw(9) << region.kernels
+     << std::setw(12) << formatBytes(region.allocated_bytes) << "  "
+     << std::string(2 * depth, ' ') << region.name << '\n';
+  for (int child : sortedChildren(region))
+    printRegion(os, child, depth + 1);
+}
+
+void printReport(std::ostream &os)
+{
+  os << "\nArborX region profile (times in seconds)\n";
+  os << std::fixed << std::setprecision(6);
+  os << std::setw(8) << "calls" << std::setw(12) << "total" << std::setw(12)
+     << "self" << std::setw(9) << "kernels" << std::setw(12) << "allocated"
+     << "  region\n";
+  printRegion(os, 0, 0);
+  os << "Peak memory: " << formatBytes(profile.peak_bytes) << '\n';
+}
+
+std::string escapeJSON(std::string const &str)
+{
+  std::string escaped;
+  for (char c : str)
+  {
+    if (c == '"' || c == '\\')
+      escaped += '\\';
+    if ((unsigned char)c < 0x20)
+      continue;
+    escaped += c;
+  }
+  return escaped;
+}
+
+void writeRegionJSON(std::ostream &os, int index, int depth)
+{
+  auto const &region = profile.regions[index];
+  std::string const indent(2 * depth + 2, ' ');
+  os << indent << "{\n";
+  os << indent << "  \"name\": \"" << escapeJSON(region.name) << "\",\n";
+  os << indent << "  \"calls\": " << region.calls << ",\n";
+  os << indent << "  \"total_time\": " << region.total_time << ",\n";
+  os << indent << "  \"self_time\": " << selfTime(region) << ",\n";
+  os << indent << "  \"kernels\": " << region.kernels << ",\n";
+  os << indent << "  \"allocations\": " << region.allocations << ",\n";
+  os << indent << "  \"allocated_bytes\": " << region.allocated_bytes
+     << ",\n";
+  os << indent << "  \"children\": [";
+  auto const children = sortedChildren(region);
+  for (std::size_t k = 0; k < children.size(); ++k)
+  {
+    os << (k == 0 ? "\n" : ",\n");
+    writeRegionJSON(os, children[k], depth + 2);
+  }
+  os << (children.empty() ? "" : "\n" + indent + "  ") << "]\n";
+  os << indent << '}';
+}
+
+void writeJSON(std::ostream &os)
+{
+  os << std::setprecision(9);
+  os << "{\n";
+  os << "  \"peak_memory\": " << profile.peak_bytes << ",\n";
+  os << "  \"root\":\n";
+  writeRegionJSON(os, 0, 0);
+  os << "\n}\n";
+}
+
+void beginKernel(std::uint64_t *kernel_id)
+{
+  std::lock_guard<std::mutex> lock(profile.mutex);
+  ++profile.regions[currentRegion()].kernels;
+  *kernel_id = 0;
+}
+
+} // namespace
+
+// Same layout as Kokkos_Profiling_SpaceHandle, so that the library does not
+// depend on Kokkos
+struct SpaceHandle
+{
+  char name[64];
+};
+
+extern "C" void kokkosp_init_library(int const, std::uint64_t const,
+                                     std::uint32_t const, void *)
+{
+  profile.regions.clear();
+  profile.regions.push_back(Region{"(root)", -1, {}});
+  profile.start = Clock::now();
+}
+
+extern "C" void kokkosp_finalize_library()
+{
+  auto &root = profile.regions[0];
+  root.calls = 1;
+  root.total_time = seconds(Clock::now() - profile.start);
+
+  printReport(std::cout);
+
+  if (char const *filename = std::getenv("ARBORX_REGION_PROFILER_JSON"))
+  {
+    std::ofstream os(filename);
+    writeJSON(os);
+    std::cout << "Region profile written to \"" << filename << "\"\n";
+  }
+}
+
+extern "C" void kokkosp_push_profile_region(char const *name)
+{
+  std::lock_guard<std::mutex> lock(profile.mutex);
+  int const parent = currentRegion();
+  auto [it, inserted] = profile.regions[parent].children.emplace(
+      name, (int)profile.regions.size());
+  int const index = it->second;
+  if (inserted)
+    profile.regions.push_back(Region{name, parent, {}});
+  ++profile.regions[index].calls;
+  stack.push_back({index, Clock::now()});
+}
+
+extern "C" void kokkosp_pop_profile_region()
+{
+  auto const end = Clock::now();
+  if (stack.empty())
+    return;
+  std::lock_guard<std::mutex> lock(profile.mutex);
+  auto const frame = stack.back();
+  stack.pop_back();
+  auto &region = profile.regions[frame.region];
+  double const elapsed = seconds(end - frame.start);
+  region.total_time += elapsed;
+  profile.regions[region.parent].children_time += elapsed;
+}
+
+extern "C" void kokkosp_begin_parallel_for(char const *, std::uint32_t,
+                                           std::uint64_t *kernel_id)
+{
+  beginKernel(kernel_id);
+}
+
+extern "C" void kokkosp_end_parallel_for(std::uint64_t) {}
+
+extern "C" void kokkosp_begin_parallel_reduce(char const *, std::uint32_t,
+                                              std::uint64_t *kernel_id)
+{
+  beginKernel(kernel_id);
+}
+
+extern "C" void kokkosp_end_parallel_reduce(std::uint64_t) {}
+
+extern "C" void kokkosp_begin_parallel_scan(char const *, std::uint32_t,
+                                            std::uint64_t *kernel_id)
+{
+  beginKernel(kernel_id);
+}
+
+extern "C" void kokkosp_end_parallel_scan(std::uint64_t) {}
+
+extern "C" void kokkosp_allocate_data(SpaceHandle const, char const *,
+                                      void const *, std::uint64_t const size)
+{
+  std::lock_guard<std::mutex> lock(profile.mutex);
+  auto &region = profile.regions[currentRegion()];
+  ++region.allocations;
+  region.allocated_bytes += size;
+  profile.current_bytes += size;
+  profile.peak_bytes = std::max(profile.peak_bytes, profile.current_bytes);
+}
+
+extern "C" void kokkosp_deallocate_data(SpaceHandle const, char const *,
+                                        void const *, std::uint64_t const size)
+{
+  std::lock_guard<std::mutex> lock(profile.mutex);
+  profile.current_bytes -= size;
+}
@@ -0,0 +1,353 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include <ArborXBenchmark_PointCloudFiles.hpp>
+#include <ArborXBenchmark_PointClouds.hpp>
+#include <ArborX_DBSCAN.hpp>
+#include <ArborX_InterpMovingLeastSquares.hpp>
+#include <ArborX_LinearBVH.hpp>
+#include <ArborX_Point.hpp>
+#include <ArborX_Version.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+using ExecutionSpace = Kokkos::DefaultExecutionSpace;
+using MemorySpace = ExecutionSpace::memory_space;
+using Point = ArborX::Point<3>;
+
+namespace ArborXBenchmark
+{
+
+// Track the bytes allocated by Kokkos in all memory spaces through the tools
+// interface, so that the memory high-water mark of each case can be reported
+// alongside its timings. The callbacks would replace those of a loaded tools
+// library (e.g., a profiler), so that the tracking is disabled in that case.
+struct MemoryTracker
+{
+  static inline bool enabled = false;
+  static inline std::int64_t current = 0;
+  static inline std::int64_t high_water = 0;
+
+  static void allocate(Kokkos::Profiling::SpaceHandle, char const *,
+                       void const *, std::uint64_t size)
+  {
+    current += size;
+    high_water = std::max(high_water, current);
+  }
+  static void deallocate(Kokkos::Profiling::SpaceHandle, char const *,
+                         void const *, std::uint64_t size)
+  {
+    current -= size;
+  }
+
+  static bool enable()
+  {
+    if (Kokkos::Tools::profileLibraryLoaded())
+      return false;
+    Kokkos::Tools::Experimental::set_allocate_data_callback(allocate);
+    Kokkos::Tools::Experimental::set_deallocate_data_callback(deallocate);
+    enabled = true;
+    return true;
+  }
+  static void reset() { high_water = current; }
+};
+
+struct CaseResult
+{
+  std::string suite;
+  int size;
+  int num_items;
+  std::vector<double> times;
+  // Peak memory allocated during the case on top of the memory that was
+  // already allocated when it started
+  std::int64_t memory_high_water;
+};
+
+// Run the case once to warm up, then time each repetition
+template <typename Case>
+CaseResult measure(ExecutionSpace const &space, std::string const &suite,
+                   int size, int num_items, int repetitions, Case &&run_case)
+{
+  run_case();
+  space.fence();
+
+  CaseResult result{suite, size, num_items, {}, 0};
+  MemoryTracker::reset();
+  auto const memory_start = MemoryTracker::current;
+  for (int i = 0; i < repetitions; ++i)
+  {
+    space.fence();
+    Kokkos::Timer timer;
+    run_case();
+    space.fence();
+    result.times.push_back(timer.seconds());
+  }
+  result.memory_high_water = MemoryTracker::high_water - memory_start;
+  return result;
+}
+
+struct CountCallback
+{
+  Kokkos::View<int *, MemorySpace> _counts;
+
+  template <typename Query, typename Value>
+  KOKKOS_FUNCTION void operator()(Query const &query, Value const &) const
+  {
+    Kokkos::atomic_inc(&_counts(ArborX::getData(query)));
+  }
+};
+
+// Points either read from a file or generated, in which case the file name
+// is empty
+struct PointSource
+{
+  std::string filename;
+  PointCloudType point_cloud_type;
+};
+
+auto makePoints(ExecutionSpace const &space, PointSource const &source, int n,
+                std::string const &label)
+{
+  Kokkos::View<Point *, MemorySpace> points(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing, label), n);
+  if (!source.filename.empty())
+  {
+    readPointCloud(space, source.filename, points, n);
+    if (points.extent_int(0) < n)
+      throw std::runtime_error('"' + source.filename +
+                               "\" contains fewer than " + std::to_string(n) +
+                               " points");
+    return points;
+  }
+  // Constant density of points as the size changes
+  generatePointCloud(space, source.point_cloud_type, std::cbrt(n), points);
+  return points;
+}
+
+std::vector<CaseResult> runSuite(ExecutionSpace const &space,
+                                 PointSource const &source,
+                                 std::string const &suite, int n,
+                                 int num_neighbors, int repetitions)
+{
+  auto const points = makePoints(space, source, n, "Benchmark::points");
+  // The points of a file are also used as queries
+  auto const queries =
+      (source.filename.empty()
+           ? makePoints(space, source, n, "Benchmark::queries")
+           : points);
+
+  // Radius for which the number of neighbors of the uniformly distributed
+  // points is approximately num_neighbors (see bvh_driver)
+  float const radius =
+      std::cbrt(num_neighbors * 6. / Kokkos::numbers::pi_v<double>);
+
+  std::vector<CaseResult> results;
+  if (suite == "construction")
+  {
+    results.push_back(measure(space, suite, n, n, repetitions, [&] {
+      ArborX::BoundingVolumeHierarchy bvh(space, points);
+    }));
+  }
+  else if (suite == "spatial" || suite == "nearest")
+  {
+    ArborX::BoundingVolumeHierarchy bvh(space, points);
+    Kokkos::View<int *, MemorySpace> counts("Benchmark::counts", n);
+    results.push_back(measure(space, suite, n, n, repetitions, [&] {
+      if (suite == "spatial")
+        bvh.query(space,
+                  ArborX::Experimental::attach_indices(
+                      ArborX::Experimental::make_intersects(queries, radius)),
+                  CountCallback{counts});
+      else
+        bvh.query(space,
+                  ArborX::Experimental::attach_indices(
+                      ArborX::Experimental::make_nearest(queries,
+                                                         num_neighbors)),
+                  CountCallback{counts});
+    }));
+  }
+  else if (suite == "crs")
+  {
+    ArborX::BoundingVolumeHierarchy bvh(space, points);
+    results.push_back(measure(space, suite, n, n, repetitions, [&] {
+      Kokkos::View<Point *, MemorySpace> values("Benchmark::values", 0);
+      Kokkos::View<int *, MemorySpace> offsets("Benchmark::offsets", 0);
+      bvh.query(space, ArborX::Experimental::make_intersects(queries, radius),
+                values, offsets);
+    }));
+  }
+  else if (suite == "clustering")
+  {
+    results.push_back(measure(space, suite, n, n, repetitions, [&] {
+      ArborX::dbscan(space, points, radius, num_neighbors / 2);
+    }));
+  }
+  else if (suite == "interpolation")
+  {
+    Kokkos::View<double *, MemorySpace> source_values(
+        "Benchmark::source_values", n);
+    Kokkos::deep_copy(space, source_values, 1.);
+    Kokkos::View<double *, MemorySpace> target_values(
+        Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                           "Benchmark::target_values"),
+        n);
+    results.push_back(measure(space, suite, n, n, repetitions, [&] {
+      ArborX::Interpolation::MovingLeastSquares<MemorySpace> mls(space, points,
+                                                                 queries);
+      mls.interpolate(space, source_values, target_values);
+    }));
+  }
+  else
+  {
+    throw std::runtime_error("Unknown suite \"" + suite + '"');
+  }
+  return results;
+}
+
+void writeJSON(std::ostream &os, std::vector<CaseResult> const &results)
+{
+  os << std::setprecision(9);
+  os << "{\n";
+  os << "  \"arborx_version\": \"" << ArborX::version() << "\",\n";
+  os << "  \"arborx_commit\": \"" << ArborX::gitCommitHash() << "\",\n";
+  os << "  \"execution_space\": \"" << ExecutionSpace::name() << "\",\n";
+  os << "  \"cases\": [";
+  for (std::size_t k = 0; k < results.size(); ++k)
+  {
+    auto const &result = results[k];
+
+    auto times = result.times;
+    std::sort(times.begin(), times.end());
+    int const num_times = times.size();
+    double const median = (num_times % 2 == 1
+                               ? times[num_times / 2]
+                               : (times[num_times / 2 - 1] +
+                                  times[num_times / 2]) /
+                                     2);
+    double const mean =
+        std::accumulate(times.begin(), times.end(), 0.) / num_times;
+    double variance = 0;
+    for (auto time : times)
+      variance += (time - mean) * (time - mean);
+    double const stddev =
+        (num_times > 1 ? std::sqrt(variance / (num_times - 1)) : 0.);
+
+    os << (k == 0 ? "\n" : ",\n");
+    os << "    {\n";
+    os << "      \"name\": \"" << result.suite << '/' << result.size
+       << "\",\n";
+    os << "      \"suite\": \"" << result.suite << "\",\n";
+    os << "      \"size\": " << result.size << ",\n";
+    os << "      \"repetitions\": " << num_times << ",\n";
+    os << "      \"time_min\": " << times.front() << ",\n";
+    os << "      \"time_median\": " << median << ",\n";
+    os << "      \"time_stddev\": " << stddev << ",\n";
+    os << "      \"rate\": " << result.num_items / median;
+    if (MemoryTracker::enabled)
+      os << ",\n      \"memory_high_water\": " << result.memory_high_water;
+    os << '\n';
+    os << "    }";
+  }
+  os << "\n  ]\n}\n";
+}
+
+} // namespace ArborXBenchmark
+
+int main(int argc, char *argv[])
+{
+  Kokkos::ScopeGuard guard(argc, argv);
+
+  std::vector<std::string> suites;
+  std::vector<int> sizes;
+  int num_neighbors;
+  int repetitions;
+  std::string output_filename;
+  std::string point_cloud_type;
+  std::string filename;
+
+  namespace bpo = boost::program_options;
+  bpo::options_description desc("Allowed options");
+  // clang-format off
+  desc.add_options()
+      ( "help", "help message" )
+      ( "suites", bpo::value<std::vector<std::string>>(&suites)->multitoken()->default_value({"construction", "spatial", "nearest", "crs", "clustering", "interpolation"}, "all"), "suites to run (construction, spatial, nearest, crs, clustering, interpolation)" )
+      ( "sizes", bpo::value<std::vector<int>>(&sizes)->multitoken()->default_value({10000, 100000}, "10000 100000"), "numbers of points" )
+      ( "neighbors", bpo::value<int>(&num_neighbors)->default_value(10), "desired number of results per query" )
+      ( "point-cloud-type", bpo::value<std::string>(&point_cloud_type)->default_value("filled_box"), "shape of the generated point clouds (filled_box | hollow_box | filled_sphere | hollow_sphere | gaussian_mixture | fractal | surface)" )
+      ( "filename", bpo::value<std::string>(&filename), "read the points from a file (.ply, .xyz, or ArborX binary format) instead of generating them" )
+      ( "repetitions", bpo::value<int>(&repetitions)->default_value(5), "number of timed repetitions of each case" )
+      ( "output", bpo::value<std::string>(&output_filename)->default_value("-"), "JSON output file (- for standard output)" )
+      ;
+  // clang-format on
+  bpo::variables_map vm;
+  bpo::store(bpo::command_line_parser(argc, argv).options(desc).run(), vm);
+  bpo::notify(vm);
+
+  if (vm.count("help") > 0)
+  {
+    std::cout << desc << '\n';
+    std::cout << "The results can be compared to a baseline with "
+                 "scripts/benchmark_compare.py\n";
+    std::cout << "The memory high-water marks are tracked through the Kokkos "
+                 "Tools callbacks, and\nare not reported when a tools "
+                 "library is loaded (e.g., with --kokkos-tools-libs)\n";
+    return 1;
+  }
+  if (repetitions < 1 || num_neighbors < 1)
+  {
+    std::cerr << "The number of repetitions and neighbors must be positive\n";
+    return 1;
+  }
+
+  using namespace ArborXBenchmark;
+
+  PointSource const source{filename, to_point_cloud_enum(point_cloud_type)};
+
+  if (!MemoryTracker::enable())
+    std::cerr << "A Kokkos Tools library is loaded, the memory high-water "
+                 "marks are not reported\n";
+
+  ExecutionSpace space;
+  std::vector<CaseResult> results;
+  for (auto const &suite : suites)
+    for (int n : sizes)
+    {
+      std::cerr << "Running " << suite << '/' << n << '\n';
+      auto suite_results =
+          runSuite(space, source, suite, n, num_neighbors, repetitions);
+      results.insert(results.end(), suite_results.begin(),
+                     suite_results.end());
+    }
+
+  if (output_filename == "-")
+  {
+    writeJSON(std::cout, results);
+  }
+  else
+  {
+    std::ofstream os(output_filename);
+    writeJSON(os, results);
+  }
+
+  return 0;
+}
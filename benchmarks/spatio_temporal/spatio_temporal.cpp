@@ -0,0 +1,212 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include <ArborX.hpp>
+#include <ArborX_SpatioTemporal.hpp>
+#include <ArborX_Version.hpp>
+#include <kokkos_ext/ArborX_KokkosExtVersion.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include <chrono>
+#include <iostream>
+
+#include <benchmark/benchmark.h>
+
+using Box4 = ArborX::Box<4>;
+
+constexpr int num_steps = 100;
+constexpr float domain_size = 100.f;
+constexpr float max_speed = 1.f;
+
+// Trajectories of objects moving with a slowly varying random velocity
+// (correlated random walk), reflected at the boundary of the domain. Each
+// trajectory is stored as num_steps segments bounded by (x, y, z, t) boxes.
+template <typename ExecutionSpace>
+auto buildTrajectories(ExecutionSpace const &exec_space, int num_objects)
+{
+  using MemorySpace = typename ExecutionSpace::memory_space;
+  Kokkos::View<Box4 *, MemorySpace> segments(
+      Kokkos::view_alloc(exec_space, Kokkos::WithoutInitializing,
+                         "Benchmark::segments"),
+      num_objects * num_steps);
+
+  Kokkos::Random_XorShift1024_Pool<ExecutionSpace> rand_pool(1984);
+  Kokkos::parallel_for(
+      "Benchmark::generate_trajectories",
+      Kokkos::RangePolicy(exec_space, 0, num_objects), KOKKOS_LAMBDA(int i) {
+        auto rand_gen = rand_pool.get_state();
+        float x[3];
+        float v[3];
+        for (int d = 0; d < 3; ++d)
+        {
+          x[d] = rand_gen.frand(0.f, domain_size);
+          v[d] = rand_gen.frand(-max_speed, max_speed);
+        }
+        for (int s = 0; s < num_steps; ++s)
+        {
+          Box4 segment;
+          for (int d = 0; d < 3; ++d)
+          {
+            auto x_next = x[d] + v[d];
+            if (x_next < 0 || x_next > domain_size)
+            {
+              v[d] = -v[d];
+              x_next = x[d] + v[d];
+            }
+            segment.minCorner()[d] = Kokkos::min(x[d], x_next);
+            segment.maxCorner()[d] = Kokkos::max(x[d], x_next);
+            x[d] = x_next;
+            v[d] = Kokkos::clamp(v[d] + rand_gen.frand(-0.1f, 0.1f),
+                                 -max_speed, max_speed);
+          }
+          segment.minCorner()[3] = s;
+          segment.maxCorner()[3] = s + 1;
+          segments(i * num_steps + s) = segment;
+        }
+        rand_pool.free_state(rand_gen);
+      });
+  return segments;
+}
+
+// "Which objects were within a radius of a point during a time window?"
+template <typename ExecutionSpace>
+auto buildQueries(ExecutionSpace const &exec_space, int num_queries)
+{
+  using MemorySpace = typename ExecutionSpace::memory_space;
+  using ArborX::Experimental::intersects_during;
+  using Predicate =
+      decltype(intersects_during(ArborX::Sphere<3>{}, 0.f, 0.f));
+  Kokkos::View<Predicate *, MemorySpace> queries(
+      Kokkos::view_alloc(exec_space, Kokkos::WithoutInitializing,
+                         "Benchmark::queries"),
+      num_queries);
+
+  constexpr float radius = 2.f;
+  constexpr float window = 10.f;
+  Kokkos::Random_XorShift1024_Pool<ExecutionSpace> rand_pool(2025);
+  Kokkos::parallel_for(
+      "Benchmark::generate_queries",
+      Kokkos::RangePolicy(exec_space, 0, num_queries), KOKKOS_LAMBDA(int i) {
+        auto rand_gen = rand_pool.get_state();
+        ArborX::Point<3> center;
+        for (int d = 0; d < 3; ++d)
+          center[d] = rand_gen.frand(0.f, domain_size);
+        auto const t_begin = rand_gen.frand(0.f, num_steps - window);
+        queries(i) = intersects_during(ArborX::Sphere{center, radius}, t_begin,
+                                       t_begin + window);
+        rand_pool.free_state(rand_gen);
+      });
+  return queries;
+}
+
+template <typename SpaceFillingCurve>
+void BM_construction(benchmark::State &state)
+{
+  using ExecutionSpace = Kokkos::DefaultExecutionSpace;
+
+  ExecutionSpace exec_space;
+
+  auto const segments = buildTrajectories(exec_space, state.range(0));
+
+  for (auto _ : state)
+  {
+    exec_space.fence();
+    auto const start = std::chrono::high_resolution_clock::now();
+
+    ArborX::BoundingVolumeHierarchy bvh(
+        exec_space, ArborX::Experimental::attach_indices(segments),
+        ArborX::Experimental::DefaultIndexableGetter{}, SpaceFillingCurve{});
+
+    exec_space.fence();
+    auto const end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed_seconds = end - start;
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+  state.counters["rate"] = benchmark::Counter(
+      segments.size(), benchmark::Counter::kIsIterationInvariantRate);
+}
+
+template <typename SpaceFillingCurve>
+void BM_query(benchmark::State &state)
+{
+  using ExecutionSpace = Kokkos::DefaultExecutionSpace;
+  using MemorySpace = ExecutionSpace::memory_space;
+
+  ExecutionSpace exec_space;
+
+  auto const segments = buildTrajectories(exec_space, state.range(0));
+  auto const queries = buildQueries(exec_space, state.range(1));
+
+  ArborX::BoundingVolumeHierarchy const bvh(
+      exec_space, ArborX::Experimental::attach_indices(segments),
+      ArborX::Experimental::DefaultIndexableGetter{}, SpaceFillingCurve{});
+
+  Kokkos::View<ArborX::PairValueIndex<Box4> *, MemorySpace> values(
+      "Benchmark::values", 0);
+  Kokkos::View<int *, MemorySpace> offsets("Benchmark::offsets", 0);
+  for (auto _ : state)
+  {
+    exec_space.fence();
+    auto const start = std::chrono::high_resolution_clock::now();
+
+    bvh.query(exec_space, queries, values, offsets);
+
+    exec_space.fence();
+    auto const end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed_seconds = end - start;
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+  state.counters["rate"] = benchmark::Counter(
+      queries.size(), benchmark::Counter::kIsIterationInvariantRate);
+  state.counters["results"] = values.size();
+}
+
+int main(int argc, char *argv[])
+{
+  Kokkos::ScopeGuard guard(argc, argv);
+
+  std::cout << "ArborX version    : " << ArborX::version() << std::endl;
+  std::cout << "ArborX hash       : " << ArborX::gitCommitHash() << std::endl;
+  std::cout << "Kokkos version    : " << ArborX::Details::KokkosExt::version()
+            << std::endl;
+
+  benchmark::Initialize(&argc, argv);
+
+  using ArborX::Experimental::Morton64;
+  using ArborX::Experimental::TimeMajorMorton64;
+
+  BENCHMARK_TEMPLATE1(BM_construction, Morton64)
+      ->RangeMultiplier(10)
+      ->Range(1000, 10000)
+      ->UseManualTime()
+      ->Unit(benchmark::kMicrosecond);
+  BENCHMARK_TEMPLATE1(BM_construction, TimeMajorMorton64<>)
+      ->RangeMultiplier(10)
+      ->Range(1000, 10000)
+      ->UseManualTime()
+      ->Unit(benchmark::kMicrosecond);
+  BENCHMARK_TEMPLATE1(BM_query, Morton64)
+      ->Args({1000, 10000})
+      ->Args({10000, 10000})
+      ->UseManualTime()
+      ->Unit(benchmark::kMicrosecond);
+  BENCHMARK_TEMPLATE1(BM_query, TimeMajorMorton64<>)
+      ->Args({1000, 10000})
+      ->Args({10000, 10000})
+      ->UseManualTime()
+      ->Unit(benchmark::kMicrosecond);
+
+  benchmark::RunSpecifiedBenchmarks();
+
+  return EXIT_SUCCESS;
+}
@@ -13,6 +13,7 @@
 #include <ArborXBenchmark_PointClouds.hpp>
 #include <ArborX_Triangle.hpp>
 #include <ArborX_Version.hpp>
+#include <detail/ArborX_TriangleMeshSignedDistance.hpp>
 
 #include <Kokkos_Profiling_ScopedRegion.hpp>
 
@@ -125,6 +126,7 @@ int main(int argc, char *argv[])
   int n;
   int num_refinements;
   float radius;
+  int grid_size;
   std::string vtk_filename;
   // clang-format off
   desc.add_options()
@@ -132,6 +134,8 @@ int main(int argc, char *argv[])
       ( "n", bpo::value<int>(&n)->default_value(1000), "number of points" )
       ( "radius", bpo::value<float>(&radius)->default_value(1.f), "sphere radius" )
       ( "refinements", bpo::value<int>(&num_refinements)->default_value(5), "number of icosahedron refinements" )
+      ( "signed", "compute signed distances" )
+      ( "grid-size", bpo::value<int>(&grid_size)->default_value(0), "number of grid nodes per dimension for signed distances" )
       ( "vtk-filename", bpo::value<std::string>(&vtk_filename), "filename to dump mesh to in VTK format" )
       ;
   // clang-format on
@@ -174,5 +178,51 @@ int main(int argc, char *argv[])
   index.query(space, ArborX::Experimental::make_nearest(random_points, 1),
               DistanceCallback{}, distances, offset);
 
+  if (vm.count("signed") > 0)
+  {
+    // The refinement does not preserve the orientation of the triangles, so
+    // orient them outwards from the center of the sphere
+    Kokkos::Profiling::pushRegion("Benchmark::orient_triangles");
+    Kokkos::View<int *[3], MemorySpace> oriented_triangles(
+        Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                           "Benchmark::oriented_triangles"),
+        triangles.size());
+    Kokkos::parallel_for(
+        "Benchmark::orient_triangles",
+        Kokkos::RangePolicy(space, 0, triangles.size()),
+        KOKKOS_LAMBDA(int i) {
+          auto const &a = vertices(triangles(i)[0]);
+          auto const &b = vertices(triangles(i)[1]);
+          auto const &c = vertices(triangles(i)[2]);
+          bool const outwards = ((b - a).cross(c - a)).dot(a - Point{}) > 0;
+          oriented_triangles(i, 0) = triangles(i)[0];
+          oriented_triangles(i, 1) = triangles(i)[outwards ? 1 : 2];
+          oriented_triangles(i, 2) = triangles(i)[outwards ? 2 : 1];
+        });
+    Kokkos::Profiling::popRegion();
+
+    ArborX::Experimental::TriangleMeshSignedDistance<MemorySpace>
+        signed_distance(space, vertices, oriented_triangles);
+
+    Kokkos::View<float *, MemorySpace> signed_distances(
+        "Benchmark::signed_distances", 0);
+    signed_distance.evaluate(space, random_points, signed_distances);
+
+    if (grid_size > 1)
+    {
+      std::cout << "#grid nodes       : "
+                << (size_t)grid_size * grid_size * grid_size << '\n';
+
+      // The grid covers the sphere with a margin
+      float const extent = 2.4f * radius;
+      Point const origin{-extent / 2, -extent / 2, -extent / 2};
+      Kokkos::View<float *, MemorySpace> grid_distances(
+          "Benchmark::grid_distances", 0);
+      signed_distance.evaluateOnGrid(space, origin, extent / (grid_size - 1),
+                                     grid_size, grid_size, grid_size,
+                                     grid_distances);
+    }
+  }
+
   return 0;
 }
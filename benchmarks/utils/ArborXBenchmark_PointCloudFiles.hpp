@@ -0,0 +1,567 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#ifndef ARBORX_BENCHMARK_POINT_CLOUD_FILES_HPP
+#define ARBORX_BENCHMARK_POINT_CLOUD_FILES_HPP
+
+#include <ArborX_GeometryTraits.hpp>
+#include <kokkos_ext/ArborX_KokkosExtViewHelpers.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <algorithm> // min, max
+#include <cstdint>
+#include <cstdlib> // strtod
+#include <cstring> // memcpy
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility> // swap
+#include <vector>
+
+namespace ArborXBenchmark
+{
+
+// Supported formats, chosen from the extension of the file:
+// - .ply: PLY (ASCII or binary), using the x, y, z properties of the vertices
+// - .xyz: one point per line, with extra columns ignored
+// - otherwise: ArborX binary format, i.e., the number of points and the
+//   dimension as 32-bit integers followed by the coordinates as floats
+enum class PointCloudFileFormat
+{
+  arborx_binary,
+  ply,
+  xyz
+};
+
+inline PointCloudFileFormat pointCloudFileFormat(std::string const &filename)
+{
+  auto ends_with = [&filename](std::string const &suffix) {
+    return filename.size() >= suffix.size() &&
+           filename.compare(filename.size() - suffix.size(), suffix.size(),
+                            suffix) == 0;
+  };
+  if (ends_with(".ply"))
+    return PointCloudFileFormat::ply;
+  if (ends_with(".xyz"))
+    return PointCloudFileFormat::xyz;
+  return PointCloudFileFormat::arborx_binary;
+}
+
+namespace Details
+{
+
+// Number of points read from the file at once
+constexpr int point_cloud_file_chunk_size = 1 << 20;
+
+inline std::ifstream openPointCloudFile(std::string const &filename)
+{
+  std::ifstream input(filename, std::ifstream::binary);
+  if (!input.good())
+    throw std::runtime_error("Error reading file \"" + filename + "\"");
+  return input;
+}
+
+// Copy the chunks of points read on the host to consecutive ranges of the
+// output. The chunks alternate between two host buffers: the copy of a chunk
+// is waited for only before its buffer is handed out again, so that reading
+// and parsing the next chunk overlaps with it. For a device output, the
+// buffers are page-locked, as copies from pageable memory are synchronous.
+template <typename ExecutionSpace, typename Points>
+class PointCloudChunkWriter
+{
+  using Point = typename Points::value_type;
+  using BufferMemorySpace = std::conditional_t<
+      Kokkos::SpaceAccessibility<Kokkos::HostSpace,
+                                 typename Points::memory_space>::accessible,
+      Kokkos::HostSpace, Kokkos::SharedHostPinnedSpace>;
+  using Buffer = Kokkos::View<Point *, BufferMemorySpace>;
+
+  ExecutionSpace _space;
+  Points _points;
+  Buffer _buffers[2];
+  int _offset = 0;
+
+public:
+  PointCloudChunkWriter(ExecutionSpace const &space, Points const &points)
+      : _space(space)
+      , _points(points)
+  {}
+
+  auto buffer(int count)
+  {
+    auto &buffer = _buffers[0];
+    if ((int)buffer.size() < count)
+      Kokkos::realloc(Kokkos::view_alloc(Kokkos::WithoutInitializing),
+                      buffer, count);
+    return Kokkos::subview(buffer, Kokkos::make_pair(0, count));
+  }
+
+  void commit(int count)
+  {
+    if (_offset + count > (int)_points.size())
+      throw std::runtime_error("Too many points in the file");
+    // Wait for the copy of the previous chunk, whose buffer is handed out
+    // next
+    _space.fence();
+    Kokkos::deep_copy(
+        _space,
+        Kokkos::subview(_points, Kokkos::make_pair(_offset, _offset + count)),
+        Kokkos::subview(_buffers[0], Kokkos::make_pair(0, count)));
+    _offset += count;
+    std::swap(_buffers[0], _buffers[1]);
+  }
+
+  int finalize()
+  {
+    _space.fence();
+    return _offset;
+  }
+};
+
+// Read the lines of the input in chunks, skipping empty lines and comments,
+// and call the function with the text of each chunk and the offsets of its
+// lines. The lines are null-terminated.
+template <typename Function>
+void forEachLinesChunk(std::istream &input, long long max_num_lines,
+                       Function &&function)
+{
+  std::string text;
+  std::vector<std::size_t> offsets;
+  std::string line;
+  long long num_lines = 0;
+  while (num_lines < max_num_lines && std::getline(input, line))
+  {
+    auto const first = line.find_first_not_of(" \t\r");
+    if (first == std::string::npos || line[first] == '#')
+      continue;
+    offsets.push_back(text.size());
+    text.append(line, first);
+    text.push_back('\0');
+    ++num_lines;
+    if ((int)offsets.size() == point_cloud_file_chunk_size)
+    {
+      function(text, offsets);
+      text.clear();
+      offsets.clear();
+    }
+  }
+  if (!offsets.empty())
+    function(text, offsets);
+}
+
+// Parse the lines of a chunk in parallel on the host. The coordinates of the
+// point are the columns given, in order.
+template <typename Buffer>
+void parseLines(std::string const &text,
+                std::vector<std::size_t> const &offsets,
+                std::vector<int> const &columns, Buffer const &buffer)
+{
+  using Point = typename Buffer::value_type;
+  constexpr int DIM = ArborX::GeometryTraits::dimension_v<Point>;
+  using Coordinate = ArborX::GeometryTraits::coordinate_type_t<Point>;
+
+  constexpr int max_num_columns = 16;
+  int num_columns = 0;
+  for (int column : columns)
+    num_columns = std::max(num_columns, column + 1);
+  if (num_columns > max_num_columns)
+    throw std::runtime_error("Too many columns before the coordinates");
+
+  int num_errors = 0;
+  Kokkos::parallel_reduce(
+      "ArborXBenchmark::parse_lines",
+      Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0,
+                                                             offsets.size()),
+      [&](int i, int &update) {
+        char const *s = text.data() + offsets[i];
+        double values[max_num_columns];
+        for (int column = 0; column < num_columns; ++column)
+        {
+          char *end;
+          double const value = std::strtod(s, &end);
+          if (end == s)
+          {
+            ++update;
+            return;
+          }
+          values[column] = value;
+          s = end;
+        }
+        for (int d = 0; d < DIM; ++d)
+          buffer(i)[d] = (Coordinate)values[columns[d]];
+      },
+      num_errors);
+  if (num_errors > 0)
+    throw std::runtime_error("Could not parse " + std::to_string(num_errors) +
+                             " lines");
+}
+
+struct PlyHeader
+{
+  enum class Type
+  {
+    int8,
+    uint8,
+    int16,
+    uint16,
+    int32,
+    uint32,
+    float32,
+    float64
+  };
+
+  bool ascii = true;
+  bool big_endian = false;
+  long long num_vertices = 0;
+  // Byte size of a vertex in the binary formats
+  int vertex_size = 0;
+  // Index, byte offset and type of the x, y and z properties
+  int columns[3] = {-1, -1, -1};
+  int offsets[3];
+  Type types[3];
+};
+
+inline int plyTypeSize(PlyHeader::Type type)
+{
+  using Type = PlyHeader::Type;
+  switch (type)
+  {
+  case Type::int8:
+  case Type::uint8:
+    return 1;
+  case Type::int16:
+  case Type::uint16:
+    return 2;
+  case Type::int32:
+  case Type::uint32:
+  case Type::float32:
+    return 4;
+  case Type::float64:
+    return 8;
+  }
+  return 0;
+}
+
+inline PlyHeader::Type plyType(std::string const &name)
+{
+  using Type = PlyHeader::Type;
+  if (name == "char" || name == "int8")
+    return Type::int8;
+  if (name == "uchar" || name == "uint8")
+    return Type::uint8;
+  if (name == "short" || name == "int16")
+    return Type::int16;
+  if (name == "ushort" || name == "uint16")
+    return Type::uint16;
+  if (name == "int" || name == "int32")
+    return Type::int32;
+  if (name == "uint" || name == "uint32")
+    return Type::uint32;
+  if (name == "float" || name == "float32")
+    return Type::float32;
+  if (name == "double" || name == "float64")
+    return Type::float64;
+  throw std::runtime_error("Unknown PLY property type \"" + name + '"');
+}
+
+inline PlyHeader readPlyHeader(std::istream &input)
+{
+  PlyHeader header;
+
+  std::string line;
+  std::getline(input, line);
+  if (line.rfind("ply", 0) != 0)
+    throw std::runtime_error("Not a PLY file");
+
+  // The vertices must be the first element, so that the data of the other
+  // elements, which may have variable sizes, does not need to be skipped
+  bool in_vertices = false;
+  bool seen_elements = false;
+  int num_properties = 0;
+  while (std::getline(input, line))
+  {
+    std::istringstream ss(line);
+    std::string keyword;
+    ss >> keyword;
+    if (keyword == "end_header")
+      break;
+    if (keyword == "format")
+    {
+      std::string format;
+      ss >> format;
+      header.ascii = (format == "ascii");
+      header.big_endian = (format == "binary_big_endian");
+      if (!header.ascii && !header.big_endian &&
+          format != "binary_little_endian")
+        throw std::runtime_error("Unknown PLY format \"" + format + '"');
+    }
+    else if (keyword == "element")
+    {
+      std::string name;
+      long long count;
+      ss >> name >> count;
+      if (name == "vertex" && seen_elements)
+        throw std::runtime_error("PLY vertices must be the first element");
+      in_vertices = (name == "vertex");
+      if (in_vertices)
+        header.num_vertices = count;
+      seen_elements = true;
+    }
+    else if (keyword == "property" && in_vertices)
+    {
+      std::string type;
+      std::string name;
+      ss >> type >> name;
+      if (type == "list")
+        throw std::runtime_error("PLY vertex list properties not supported");
+      int const axis =
+          (name == "x" ? 0 : (name == "y" ? 1 : (name == "z" ? 2 : -1)));
+      if (axis >= 0)
+      {
+        header.columns[axis] = num_properties;
+        header.offsets[axis] = header.vertex_size;
+        header.types[axis] = plyType(type);
+      }
+      header.vertex_size += plyTypeSize(plyType(type));
+      ++num_properties;
+    }
+  }
+  for (int axis = 0; axis < 3; ++axis)
+    if (header.columns[axis] < 0)
+      throw std::runtime_error("PLY vertices must have x, y and z");
+  return header;
+}
+
+inline double readPlyValue(char const *data, PlyHeader::Type type,
+                           bool big_endian)
+{
+  char bytes[8];
+  int const size = plyTypeSize(type);
+  std::memcpy(bytes, data, size);
+  if (big_endian)
+    for (int k = 0; k < size / 2; ++k)
+      std::swap(bytes[k], bytes[size - 1 - k]);
+
+  auto as = [&bytes](auto value) {
+    std::memcpy(&value, bytes, sizeof(value));
+    return (double)value;
+  };
+  using Type = PlyHeader::Type;
+  switch (type)
+  {
+  case Type::int8:
+    return as(std::int8_t{});
+  case Type::uint8:
+    return as(std::uint8_t{});
+  case Type::int16:
+    return as(std::int16_t{});
+  case Type::uint16:
+    return as(std::uint16_t{});
+  case Type::int32:
+    return as(std::int32_t{});
+  case Type::uint32:
+    return as(std::uint32_t{});
+  case Type::float32:
+    return as(float{});
+  case Type::float64:
+    return as(double{});
+  }
+  return 0;
+}
+
+template <typename Writer>
+void readPly(std::istream &input, PlyHeader const &header, int num_points,
+             Writer &writer)
+{
+  if (header.ascii)
+  {
+    std::vector<int> const columns(header.columns, header.columns + 3);
+    forEachLinesChunk(input, num_points,
+                      [&](std::string const &text,
+                          std::vector<std::size_t> const &offsets) {
+                        int const count = offsets.size();
+                        parseLines(text, offsets, columns,
+                                   writer.buffer(count));
+                        writer.commit(count);
+                      });
+    return;
+  }
+
+  std::vector<char> bytes;
+  for (int begin = 0; begin < num_points;
+       begin += point_cloud_file_chunk_size)
+  {
+    int const count =
+        std::min(point_cloud_file_chunk_size, num_points - begin);
+    bytes.resize((std::size_t)count * header.vertex_size);
+    if (!input.read(bytes.data(), bytes.size()))
+      throw std::runtime_error("Unexpected end of the PLY file");
+
+    auto buffer = writer.buffer(count);
+    using Coordinate = ArborX::GeometryTraits::coordinate_type_t<
+        typename decltype(buffer)::value_type>;
+    Kokkos::parallel_for(
+        "ArborXBenchmark::decode_ply",
+        Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, count),
+        [&](int i) {
+          char const *vertex =
+              bytes.data() + (std::size_t)i * header.vertex_size;
+          for (int d = 0; d < 3; ++d)
+            buffer(i)[d] = (Coordinate)readPlyValue(
+                vertex + header.offsets[d], header.types[d], header.big_endian);
+        });
+    writer.commit(count);
+  }
+}
+
+template <typename Writer>
+void readArborXBinary(std::istream &input, int dim, int num_points,
+                      Writer &writer)
+{
+  std::vector<float> coordinates;
+  for (int begin = 0; begin < num_points;
+       begin += point_cloud_file_chunk_size)
+  {
+    int const count =
+        std::min(point_cloud_file_chunk_size, num_points - begin);
+    coordinates.resize((std::size_t)count * dim);
+    if (!input.read(reinterpret_cast<char *>(coordinates.data()),
+                    coordinates.size() * sizeof(float)))
+      throw std::runtime_error("Unexpected end of the binary file");
+
+    auto buffer = writer.buffer(count);
+    using Coordinate = ArborX::GeometryTraits::coordinate_type_t<
+        typename decltype(buffer)::value_type>;
+    Kokkos::parallel_for(
+        "ArborXBenchmark::decode_binary",
+        Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, count),
+        [&](int i) {
+          for (int d = 0; d < dim; ++d)
+            buffer(i)[d] = (Coordinate)coordinates[(std::size_t)i * dim + d];
+        });
+    writer.commit(count);
+  }
+}
+
+// Number of data lines of a text file
+inline long long countLines(std::istream &input)
+{
+  long long num_lines = 0;
+  forEachLinesChunk(
+      input, std::numeric_limits<long long>::max(),
+      [&num_lines](std::string const &,
+                   std::vector<std::size_t> const &offsets) {
+        num_lines += offsets.size();
+      });
+  return num_lines;
+}
+
+} // namespace Details
+
+// Dimension of the points stored in the file
+inline int pointCloudFileDimension(std::string const &filename)
+{
+  if (pointCloudFileFormat(filename) != PointCloudFileFormat::arborx_binary)
+    return 3;
+
+  auto input = Details::openPointCloudFile(filename);
+  int num_points;
+  int dim;
+  input.read(reinterpret_cast<char *>(&num_points), sizeof(int));
+  input.read(reinterpret_cast<char *>(&dim), sizeof(int));
+  return dim;
+}
+
+// Read the points of the file, or its first max_num_points ones, into the
+// view. The file is streamed in chunks: each one is parsed in parallel on the
+// host and copied to the view while the next one is read.
+template <typename ExecutionSpace, typename Points>
+void readPointCloud(ExecutionSpace const &space, std::string const &filename,
+                    Points &points, int max_num_points = -1)
+{
+  static_assert(Kokkos::is_view_v<Points>);
+  using Point = typename Points::value_type;
+  static_assert(ArborX::GeometryTraits::is_point_v<Point>);
+  constexpr int DIM = ArborX::GeometryTraits::dimension_v<Point>;
+
+  auto limit = [max_num_points](long long num_points) {
+    return (int)(max_num_points > 0 && max_num_points < num_points
+                     ? max_num_points
+                     : num_points);
+  };
+
+  auto input = Details::openPointCloudFile(filename);
+  int num_points = 0;
+  switch (pointCloudFileFormat(filename))
+  {
+  case PointCloudFileFormat::ply:
+  {
+    if (DIM != 3)
+      throw std::runtime_error("PLY files contain 3D points");
+    auto const header = Details::readPlyHeader(input);
+    num_points = limit(header.num_vertices);
+    ArborX::Details::KokkosExt::reallocWithoutInitializing(space, points,
+                                                           num_points);
+    Details::PointCloudChunkWriter writer(space, points);
+    Details::readPly(input, header, num_points, writer);
+    num_points = writer.finalize();
+    break;
+  }
+  case PointCloudFileFormat::xyz:
+  {
+    // The number of points is not stored, so the lines are counted first
+    num_points = limit(Details::countLines(input));
+    input.clear();
+    input.seekg(0);
+    ArborX::Details::KokkosExt::reallocWithoutInitializing(space, points,
+                                                           num_points);
+    Details::PointCloudChunkWriter writer(space, points);
+    std::vector<int> columns(DIM);
+    for (int d = 0; d < DIM; ++d)
+      columns[d] = d;
+    Details::forEachLinesChunk(
+        input, num_points,
+        [&](std::string const &text, std::vector<std::size_t> const &offsets) {
+          int const count = offsets.size();
+          Details::parseLines(text, offsets, columns, writer.buffer(count));
+          writer.commit(count);
+        });
+    num_points = writer.finalize();
+    break;
+  }
+  case PointCloudFileFormat::arborx_binary:
+  {
+    int dim;
+    input.read(reinterpret_cast<char *>(&num_points), sizeof(int));
+    input.read(reinterpret_cast<char *>(&dim), sizeof(int));
+    if (dim != DIM)
+      throw std::runtime_error("Wrong dimension of the points in \"" +
+                               filename + '"');
+    num_points = limit(num_points);
+    ArborX::Details::KokkosExt::reallocWithoutInitializing(space, points,
+                                                           num_points);
+    Details::PointCloudChunkWriter writer(space, points);
+    Details::readArborXBinary(input, dim, num_points, writer);
+    num_points = writer.finalize();
+    break;
+  }
+  }
+  if (num_points != (int)points.size())
+    throw std::runtime_error("Unexpected end of the file \"" + filename + '"');
+}
+
+} // namespace ArborXBenchmark
+
+#endif
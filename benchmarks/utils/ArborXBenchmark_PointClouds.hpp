@@ -27,7 +27,10 @@ enum class PointCloudType
   filled_box,
   hollow_box,
   filled_sphere,
-  hollow_sphere
+  hollow_sphere,
+  gaussian_mixture,
+  fractal,
+  surface
 };
 
 inline PointCloudType to_point_cloud_enum(std::string const &str)
@@ -40,6 +43,12 @@ inline PointCloudType to_point_cloud_enum(std::string const &str)
     return PointCloudType::filled_sphere;
   if (str == "hollow_sphere")
     return PointCloudType::hollow_sphere;
+  if (str == "gaussian_mixture")
+    return PointCloudType::gaussian_mixture;
+  if (str == "fractal")
+    return PointCloudType::fractal;
+  if (str == "surface")
+    return PointCloudType::surface;
   throw std::runtime_error(str +
                            " doesn't correspond to any known PointCloudType!");
 }
@@ -47,6 +56,19 @@ inline PointCloudType to_point_cloud_enum(std::string const &str)
 namespace Details
 {
 
+// Reproducible pseudo-random number in [0, 1) determined by the key
+// (SplitMix64 finalizer). Used for the parameters shared by all the points,
+// such as the centers of the clusters, so that the threads agree on them
+// without sharing state.
+KOKKOS_INLINE_FUNCTION double hashToUnit(unsigned long long key)
+{
+  key += 0x9e3779b97f4a7c15ull;
+  key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ull;
+  key = (key ^ (key >> 27)) * 0x94d049bb133111ebull;
+  key ^= key >> 31;
+  return (key >> 11) * 0x1.0p-53;
+}
+
 template <typename Point>
 class PointGenerationFunctor
 {
@@ -76,6 +98,12 @@ public:
       return filledSpherePoint(generator);
     case PointCloudType::hollow_sphere:
       return hollowSpherePoint(generator);
+    case PointCloudType::gaussian_mixture:
+      return gaussianMixturePoint(generator);
+    case PointCloudType::fractal:
+      return fractalPoint(generator);
+    case PointCloudType::surface:
+      return surfacePoint(generator);
     default:
       Kokkos::abort("ArborX: implementation bug");
     }
@@ -175,6 +203,78 @@ private:
 
     return p;
   }
+
+  // Mixture of Gaussian clusters with widths spanning several scales and
+  // unequal weights, which gives dense clusters next to sparse ones
+  template <typename Generator>
+  KOKKOS_FUNCTION auto gaussianMixturePoint(Generator &generator) const
+  {
+    constexpr int num_components = 32;
+    constexpr int num_scales = 5;
+
+    auto const u = Kokkos::rand<Generator, double>::draw(generator, 0, 1);
+    int const component = Kokkos::min((int)(num_components * u * u),
+                                      num_components - 1);
+    auto const width = (Coordinate)0.2 / (1 << (component % num_scales));
+
+    Point p;
+    for (int d = 0; d < DIM; ++d)
+    {
+      auto const center = (Coordinate)(
+          0.8 * (2 * hashToUnit(component * DIM + d) - 1));
+      p[d] = center + width * (Coordinate)generator.normal();
+    }
+    return p;
+  }
+
+  // Hierarchical clustering in the spirit of the Soneira-Peebles model of the
+  // galaxy distribution: each cluster contains a few subclusters, shrunk by a
+  // constant ratio, down to a given depth. The subcluster of a point is
+  // chosen at random at each level, and the centers of the subclusters only
+  // depend on their path from the root.
+  template <typename Generator>
+  KOKKOS_FUNCTION auto fractalPoint(Generator &generator) const
+  {
+    constexpr int num_levels = 8;
+    constexpr int num_children = 4;
+    constexpr double ratio = 1.9;
+
+    Point p;
+    for (int d = 0; d < DIM; ++d)
+      p[d] = 0;
+    double radius = 1;
+    unsigned long long key = 0;
+    for (int level = 0; level < num_levels; ++level)
+    {
+      int const child =
+          Kokkos::rand<Generator, int>::draw(generator, 0, num_children);
+      key = key * num_children + child + 1;
+      for (int d = 0; d < DIM; ++d)
+        p[d] += (Coordinate)(radius * (1 - 1 / ratio) *
+                             (2 * hashToUnit(key * DIM + d) - 1));
+      radius /= ratio;
+    }
+    for (int d = 0; d < DIM; ++d)
+      p[d] += (Coordinate)(
+          radius * Kokkos::rand<Generator, double>::draw(generator, -1, 1));
+    return p;
+  }
+
+  // Samples of a closed non-convex surface, similar to a scanned object: a
+  // sphere whose radius varies with the direction
+  template <typename Generator>
+  KOKKOS_FUNCTION auto surfacePoint(Generator &generator) const
+  {
+    auto p = hollowSpherePoint(generator);
+
+    Coordinate radius = 1;
+    if constexpr (DIM > 1)
+      radius = (Coordinate)(0.8 + 0.2 * Kokkos::cos(6 * p[0]) *
+                                      Kokkos::cos(6 * p[1]));
+    for (int d = 0; d < DIM; ++d)
+      p[d] *= radius;
+    return p;
+  }
 };
 
 } // namespace Details
@@ -195,7 +295,10 @@ void generatePointCloud(ExecutionSpace const &exec,
   KOKKOS_ASSERT(point_cloud_type == PointCloudType::filled_box ||
                 point_cloud_type == PointCloudType::hollow_box ||
                 point_cloud_type == PointCloudType::filled_sphere ||
-                point_cloud_type == PointCloudType::hollow_sphere);
+                point_cloud_type == PointCloudType::hollow_sphere ||
+                point_cloud_type == PointCloudType::gaussian_mixture ||
+                point_cloud_type == PointCloudType::fractal ||
+                point_cloud_type == PointCloudType::surface);
 
   static constexpr int DIM = ArborX::GeometryTraits::dimension_v<Point>;
 
@@ -58,14 +58,17 @@ KOKKOS_FUNCTION auto distance(CustomPoint const &p, CustomPoint const &q)
 }
 
 // Provide the distance function between the bounding volume geometry and
-// the custom data type
+// the custom data type. It must be a lower bound of the distance to any
+// point within the box for the nearest search to be correct. Common metrics
+// (Manhattan, Chebyshev, weighted Euclidean) are also available out of the
+// box in ArborX_Metrics.hpp and can be passed directly to nearest().
 using BoundingVolume = ArborX::Box<2>;
 KOKKOS_FUNCTION auto distance(CustomPoint const &point,
                               BoundingVolume const &box)
 {
   CustomPoint projected_point{
       Kokkos::clamp(point.x, box.minCorner()[0], box.maxCorner()[0]),
-      Kokkos::clamp(point.y, box.minCorner()[0], box.maxCorner()[0])};
+      Kokkos::clamp(point.y, box.minCorner()[1], box.maxCorner()[1])};
   return distance(point, projected_point);
 }
 
@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+"""benchmark_compare.py
+
+Compare the results of ArborX_Benchmark_Regression.exe to a stored baseline.
+Exits with a non-zero status if any case regressed.
+
+Usage:
+  benchmark_compare.py -b BASELINE -i INPUT [-t THRESHOLD] [-m THRESHOLD] [-s SIGMAS]
+  benchmark_compare.py (-h | --help)
+
+Options:
+  -h --help                                   Show this screen.
+  -b FILE --baseline=FILE                     Baseline results in JSON format
+  -i FILE --input-file=FILE                   Current results in JSON format
+  -t THRESHOLD --threshold=THRESHOLD          Minimum relative rate decrease considered a regression [default: 0.05]
+  -m THRESHOLD --memory-threshold=THRESHOLD   Relative memory high-water increase considered a regression [default: 0.10]
+  -s SIGMAS --sigmas=SIGMAS                   Number of standard deviations of the combined timing noise that a rate decrease must exceed [default: 3]
+"""
+import json
+import math
+import sys
+from docopt import docopt
+
+def load_cases(filename):
+    with open(filename) as f:
+        data = json.load(f)
+    return data, {case['name']: case for case in data['cases']}
+
+def relative_noise(case):
+    return case['time_stddev'] / case['time_median'] if case['time_median'] > 0 else 0.
+
+def compare(baseline, current, threshold, memory_threshold, sigmas):
+    regressions = []
+    print('{:<28} {:>14} {:>14} {:>9} {:>9}  {}'.format(
+        'case', 'baseline rate', 'rate', 'change', 'allowed', 'status'))
+    for name, case in current.items():
+        if name not in baseline:
+            print('{:<28} {:>14} {:>14.4g} {:>9} {:>9}  new'.format(name, '-', case['rate'], '-', '-'))
+            continue
+        base = baseline[name]
+
+        # A rate decrease is only significant if it exceeds both the threshold
+        # and the measured noise of the two runs
+        noise = math.hypot(relative_noise(base), relative_noise(case))
+        allowed = max(threshold, sigmas * noise)
+        change = case['rate'] / base['rate'] - 1 if base['rate'] > 0 else 0.
+
+        rate_regressed = change < -allowed
+        base_memory = base.get('memory_high_water', 0)
+        memory = case.get('memory_high_water', 0)
+        memory_regressed = base_memory > 0 and memory > base_memory * (1 + memory_threshold)
+
+        if rate_regressed and memory_regressed:
+            status = 'REGRESSION (rate, memory {} -> {} bytes)'.format(base_memory, memory)
+        elif rate_regressed:
+            status = 'REGRESSION (rate)'
+        elif memory_regressed:
+            status = 'REGRESSION (memory {} -> {} bytes{})'.format(
+                base_memory, memory, ', rate improved' if change > allowed else '')
+        elif change > allowed:
+            status = 'improvement'
+        else:
+            status = 'ok'
+
+        if rate_regressed or memory_regressed:
+            regressions.append(name)
+        print('{:<28} {:>14.4g} {:>14.4g} {:>+8.1f}% {:>8.1f}%  {}'.format(
+            name, base['rate'], case['rate'], 100 * change, 100 * allowed, status))
+
+    for name in baseline:
+        if name not in current:
+            print('{:<28} missing from the current results'.format(name))
+
+    return regressions
+
+if __name__ == '__main__':
+    args = docopt(__doc__)
+
+    baseline_data, baseline = load_cases(args['--baseline'])
+    current_data, current = load_cases(args['--input-file'])
+    if baseline_data.get('execution_space') != current_data.get('execution_space'):
+        print('Warning: comparing results from different execution spaces ({} and {})'.format(
+            baseline_data.get('execution_space'), current_data.get('execution_space')))
+
+    regressions = compare(baseline, current,
+                          float(args['--threshold']),
+                          float(args['--memory-threshold']),
+                          float(args['--sigmas']))
+    if regressions:
+        print('{} regression(s): {}'.format(len(regressions), ', '.join(regressions)))
+        sys.exit(1)
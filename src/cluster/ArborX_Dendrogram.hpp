@@ -78,6 +78,13 @@ struct Dendrogram
     Kokkos::Profiling::popRegion();
   }
 
+  // Number of bytes allocated for the parents and their heights
+  std::size_t memory_footprint() const noexcept
+  {
+    return Details::KokkosExt::memorySpan(_parents) +
+           Details::KokkosExt::memorySpan(_parent_heights);
+  }
+
   template <typename ExecutionSpace>
   void splitEdges(
       ExecutionSpace const &exec_space,
@@ -0,0 +1,265 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#ifndef ARBORX_DOWNSAMPLING_HPP
+#define ARBORX_DOWNSAMPLING_HPP
+
+#include <ArborX_Box.hpp>
+#include <ArborX_DBSCAN.hpp> // PointsWithRadiusReorderedAndFiltered
+#include <ArborX_LinearBVH.hpp>
+#include <algorithms/ArborX_Distance.hpp>
+#include <detail/ArborX_AccessTraits.hpp>
+#include <detail/ArborX_AttachIndices.hpp>
+#include <detail/ArborX_CartesianGrid.hpp>
+#include <detail/ArborX_DownsamplingHelpers.hpp>
+#include <detail/ArborX_FDBSCANDenseBox.hpp> // computeCellIndices
+#include <detail/ArborX_IndexableGetter.hpp>
+#include <detail/ArborX_TreeConstruction.hpp>
+#include <kokkos_ext/ArborX_KokkosExtAccessibilityTraits.hpp>
+#include <kokkos_ext/ArborX_KokkosExtStdAlgorithms.hpp>
+#include <kokkos_ext/ArborX_KokkosExtViewHelpers.hpp>
+#include <misc/ArborX_Exception.hpp>
+#include <misc/ArborX_SortUtils.hpp>
+#include <misc/ArborX_Utils.hpp> // computeOffsetsInOrderedView
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Profiling_ScopedRegion.hpp>
+
+#include <utility> // swap
+
+namespace ArborX::Experimental
+{
+
+// Keep one point per cubic voxel of size voxel_size, the one closest to the
+// voxel center. On output, indices contains the indices of the kept points.
+// The voxels are aligned with the minimum corner of the points bounding box.
+template <typename ExecutionSpace, typename Primitives, typename Indices>
+void voxelDownsample(ExecutionSpace const &exec_space,
+                     Primitives const &primitives, float voxel_size,
+                     Indices &indices)
+{
+  Kokkos::Profiling::ScopedRegion guard("ArborX::VoxelDownsample");
+
+  namespace KokkosExt = ArborX::Details::KokkosExt;
+
+  Details::check_valid_access_traits(primitives);
+  using Points = Details::AccessValues<Primitives>;
+  using MemorySpace = typename Points::memory_space;
+  static_assert(
+      KokkosExt::is_accessible_from<MemorySpace, ExecutionSpace>::value,
+      "Primitives must be accessible from the execution space");
+  static_assert(Kokkos::is_view_v<Indices>);
+  static_assert(std::is_same_v<typename Indices::memory_space, MemorySpace>);
+
+  using Point = typename Points::value_type;
+  static_assert(GeometryTraits::is_point_v<Point>);
+  constexpr int DIM = GeometryTraits::dimension_v<Point>;
+  using Coordinate = GeometryTraits::coordinate_type_t<Point>;
+
+  ARBORX_ASSERT(voxel_size > 0);
+
+  Points points{primitives}; // NOLINT
+  int const n = points.size();
+  if (n == 0)
+  {
+    KokkosExt::reallocWithoutInitializing(exec_space, indices, 0);
+    return;
+  }
+
+  Box<DIM, Coordinate> bounds;
+  Details::TreeConstruction::calculateBoundingBoxOfTheScene(
+      exec_space,
+      Details::Indexables{points, Experimental::DefaultIndexableGetter{}},
+      bounds);
+  // Pad the upper bounds so that the points on them do not fall outside of
+  // the grid when the extent is a multiple of the voxel size
+  auto const h = static_cast<Coordinate>(voxel_size);
+  for (int d = 0; d < DIM; ++d)
+    bounds.maxCorner()[d] += h;
+  Details::CartesianGrid const grid(bounds, h);
+
+  auto cell_indices = Details::computeCellIndices(exec_space, points, grid);
+  auto permute = Details::sortObjects(exec_space, cell_indices);
+  auto &sorted_cell_indices = cell_indices; // alias
+
+  Kokkos::View<int *, MemorySpace> cell_offsets(
+      "ArborX::VoxelDownsample::cell_offsets", 0);
+  Details::computeOffsetsInOrderedView(exec_space, sorted_cell_indices,
+                                       cell_offsets);
+  int const num_cells = cell_offsets.size() - 1;
+
+  KokkosExt::reallocWithoutInitializing(exec_space, indices, num_cells);
+  Kokkos::parallel_for(
+      "ArborX::VoxelDownsample::select_points",
+      Kokkos::RangePolicy(exec_space, 0, num_cells), KOKKOS_LAMBDA(int c) {
+        auto const box = grid.cellBox(sorted_cell_indices(cell_offsets(c)));
+        Point center;
+        for (int d = 0; d < DIM; ++d)
+          center[d] = (box.minCorner()[d] + box.maxCorner()[d]) / 2;
+
+        int closest = permute(cell_offsets(c));
+        auto closest_distance = Details::distance(points(closest), center);
+        for (int k = cell_offsets(c) + 1; k < cell_offsets(c + 1); ++k)
+        {
+          int const i = permute(k);
+          auto const distance = Details::distance(points(i), center);
+          if (distance < closest_distance ||
+              (distance == closest_distance && i < closest))
+          {
+            closest = i;
+            closest_distance = distance;
+          }
+        }
+        indices(c) = closest;
+      });
+}
+
+// Select a maximal subset of the points such that no two of them are within
+// the given radius of each other. Every point that is not selected is within
+// the radius of a selected point. On output, indices contains the indices of
+// the selected points in increasing order.
+//
+// The subset is a maximal independent set of the radius graph, computed with
+// Luby's algorithm: each round selects the undecided points whose priority is
+// higher than that of all their undecided neighbors, then removes the
+// neighbors of the selected points. The priorities are random but only depend
+// on the seed, so the result is reproducible.
+template <typename ExecutionSpace, typename Primitives, typename Indices>
+void poissonDiskDownsample(ExecutionSpace const &exec_space,
+                           Primitives const &primitives, float radius,
+                           Indices &indices, unsigned seed = 0)
+{
+  Kokkos::Profiling::ScopedRegion guard("ArborX::PoissonDiskDownsample");
+
+  namespace KokkosExt = ArborX::Details::KokkosExt;
+
+  Details::check_valid_access_traits(primitives);
+  using Points = Details::AccessValues<Primitives>;
+  using MemorySpace = typename Points::memory_space;
+  static_assert(
+      KokkosExt::is_accessible_from<MemorySpace, ExecutionSpace>::value,
+      "Primitives must be accessible from the execution space");
+  static_assert(Kokkos::is_view_v<Indices>);
+  static_assert(std::is_same_v<typename Indices::memory_space, MemorySpace>);
+
+  using Point = typename Points::value_type;
+  static_assert(GeometryTraits::is_point_v<Point>);
+
+  ARBORX_ASSERT(radius >= 0);
+
+  Points points{primitives}; // NOLINT
+  int const n = points.size();
+
+  Kokkos::Profiling::pushRegion("ArborX::PoissonDiskDownsample::construction");
+  BoundingVolumeHierarchy bvh(exec_space, Experimental::attach_indices(points));
+  Kokkos::Profiling::popRegion();
+
+  using Details::DownsamplingState;
+  Kokkos::View<DownsamplingState *, MemorySpace> states(
+      Kokkos::view_alloc(exec_space, Kokkos::WithoutInitializing,
+                         "ArborX::PoissonDiskDownsample::states"),
+      n);
+  Kokkos::deep_copy(exec_space, states, DownsamplingState::undecided);
+  Kokkos::View<int *, MemorySpace> flags(
+      Kokkos::view_alloc(exec_space, Kokkos::WithoutInitializing,
+                         "ArborX::PoissonDiskDownsample::flags"),
+      n);
+
+  // Indices of the undecided points
+  Kokkos::View<int *, MemorySpace> undecided(
+      Kokkos::view_alloc(exec_space, Kokkos::WithoutInitializing,
+                         "ArborX::PoissonDiskDownsample::undecided"),
+      n);
+  KokkosExt::iota(exec_space, undecided);
+  auto remaining = KokkosExt::cloneWithoutInitializingNorCopying(
+      exec_space, undecided);
+
+  Kokkos::Profiling::pushRegion("ArborX::PoissonDiskDownsample::rounds");
+  int num_undecided = n;
+  while (num_undecided > 0)
+  {
+    auto const current =
+        Kokkos::subview(undecided, Kokkos::make_pair(0, num_undecided));
+    Details::PointsWithRadiusReorderedAndFiltered<Points, decltype(current)>
+        predicates{points, radius, current};
+
+    Kokkos::parallel_for(
+        "ArborX::PoissonDiskDownsample::set_flags",
+        Kokkos::RangePolicy(exec_space, 0, num_undecided),
+        KOKKOS_LAMBDA(int k) { flags(current(k)) = 1; });
+    bvh.query(exec_space, predicates,
+              Details::MISLocalMaximum<decltype(states), decltype(flags)>{
+                  states, flags, seed});
+
+    Kokkos::parallel_for(
+        "ArborX::PoissonDiskDownsample::select",
+        Kokkos::RangePolicy(exec_space, 0, num_undecided),
+        KOKKOS_LAMBDA(int k) {
+          int const i = current(k);
+          if (flags(i) == 1)
+            states(i) = DownsamplingState::selected;
+          flags(i) = 0;
+        });
+    bvh.query(exec_space, predicates,
+              Details::MISSelectedNeighbor<decltype(states), decltype(flags)>{
+                  states, flags});
+
+    // Keep the points that are neither selected nor removed for the next
+    // round
+    int num_remaining;
+    Kokkos::parallel_scan(
+        "ArborX::PoissonDiskDownsample::compact",
+        Kokkos::RangePolicy(exec_space, 0, num_undecided),
+        KOKKOS_LAMBDA(int k, int &update, bool final_pass) {
+          int const i = current(k);
+          if (states(i) != DownsamplingState::undecided)
+            return;
+          if (flags(i) == 1)
+          {
+            if (final_pass)
+              states(i) = DownsamplingState::removed;
+            return;
+          }
+          if (final_pass)
+            remaining(update) = i;
+          ++update;
+        },
+        num_remaining);
+    std::swap(undecided, remaining);
+    num_undecided = num_remaining;
+  }
+  Kokkos::Profiling::popRegion();
+
+  int num_selected;
+  Kokkos::parallel_reduce(
+      "ArborX::PoissonDiskDownsample::count_selected",
+      Kokkos::RangePolicy(exec_space, 0, n),
+      KOKKOS_LAMBDA(int i, int &update) {
+        if (states(i) == DownsamplingState::selected)
+          ++update;
+      },
+      num_selected);
+  KokkosExt::reallocWithoutInitializing(exec_space, indices, num_selected);
+  Kokkos::parallel_scan(
+      "ArborX::PoissonDiskDownsample::gather_selected",
+      Kokkos::RangePolicy(exec_space, 0, n),
+      KOKKOS_LAMBDA(int i, int &update, bool final_pass) {
+        if (states(i) != DownsamplingState::selected)
+          return;
+        if (final_pass)
+          indices(update) = i;
+        ++update;
+      });
+}
+
+} // namespace ArborX::Experimental
+
+#endif
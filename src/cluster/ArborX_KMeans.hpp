@@ -0,0 +1,215 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+#ifndef ARBORX_KMEANS_HPP
+#define ARBORX_KMEANS_HPP
+
+#include <ArborX_LinearBVH.hpp>
+#include <algorithms/ArborX_Distance.hpp>
+#include <detail/ArborX_AccessTraits.hpp>
+#include <detail/ArborX_AttachIndices.hpp>
+#include <detail/ArborX_KMeansHelpers.hpp>
+#include <kokkos_ext/ArborX_KokkosExtAccessibilityTraits.hpp>
+#include <kokkos_ext/ArborX_KokkosExtViewHelpers.hpp>
+#include <misc/ArborX_Exception.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Profiling_ScopedRegion.hpp>
+
+#include <type_traits>
+
+namespace ArborX::Experimental
+{
+
+namespace KMeans
+{
+struct Parameters
+{
+  // Maximum number of Lloyd iterations
+  int _max_iterations = 100;
+  // Stop when no centroid moves by more than this distance
+  float _tolerance = 0;
+  // Seed of the random sampling of the initial centroids
+  unsigned long long _seed = 0;
+  // Number of oversampling rounds of the k-means|| seeding
+  int _num_seeding_rounds = 5;
+
+  Parameters &setMaxIterations(int max_iterations)
+  {
+    _max_iterations = max_iterations;
+    return *this;
+  }
+  Parameters &setTolerance(float tolerance)
+  {
+    _tolerance = tolerance;
+    return *this;
+  }
+  Parameters &setSeed(unsigned long long seed)
+  {
+    _seed = seed;
+    return *this;
+  }
+  Parameters &setNumSeedingRounds(int num_rounds)
+  {
+    _num_seeding_rounds = num_rounds;
+    return *this;
+  }
+};
+} // namespace KMeans
+
+// Partition the points into num_clusters clusters with Lloyd's algorithm.
+// On output, labels(i) is the cluster of the point i and centroids(c) the
+// mean of the points in the cluster c. Returns the number of iterations.
+//
+// The centroids are seeded with k-means|| (a scalable variant of k-means++).
+// Each iteration builds a hierarchy over the centroids and assigns the points
+// to their nearest centroid through it, except for the points whose distance
+// bounds show that their assignment cannot change.
+template <typename ExecutionSpace, typename Primitives, typename Labels,
+          typename Centroids>
+int kmeans(ExecutionSpace const &space, Primitives const &primitives,
+           int num_clusters, Labels &labels, Centroids &centroids,
+           KMeans::Parameters const &parameters = KMeans::Parameters())
+{
+  Kokkos::Profiling::ScopedRegion guard("ArborX::KMeans");
+
+  namespace KokkosExt = ArborX::Details::KokkosExt;
+
+  Details::check_valid_access_traits(primitives);
+  using Points = Details::AccessValues<Primitives>;
+  using MemorySpace = typename Points::memory_space;
+  static_assert(
+      KokkosExt::is_accessible_from<MemorySpace, ExecutionSpace>::value,
+      "Primitives must be accessible from the execution space");
+  static_assert(Kokkos::is_view_v<Labels> && Kokkos::is_view_v<Centroids>);
+  static_assert(std::is_same_v<typename Labels::memory_space, MemorySpace>);
+  static_assert(std::is_same_v<typename Centroids::memory_space, MemorySpace>);
+
+  using Point = typename Points::value_type;
+  using Centroid = typename Centroids::value_type;
+  static_assert(GeometryTraits::is_point_v<Point>);
+  static_assert(GeometryTraits::is_point_v<Centroid>);
+  constexpr int DIM = GeometryTraits::dimension_v<Point>;
+  static_assert(GeometryTraits::dimension_v<Centroid> == DIM);
+  using Coordinate = GeometryTraits::coordinate_type_t<Centroid>;
+  using Distance = decltype(Details::distance(std::declval<Centroid>(),
+                                              std::declval<Centroid>()));
+
+  Points points{primitives}; // NOLINT
+  int const n = points.size();
+
+  ARBORX_ASSERT(num_clusters > 0 && num_clusters <= n);
+  ARBORX_ASSERT(parameters._max_iterations >= 0);
+
+  KokkosExt::reallocWithoutInitializing(space, labels, n);
+  KokkosExt::reallocWithoutInitializing(space, centroids, num_clusters);
+
+  Details::kmeansSeeding(space, points, num_clusters, centroids,
+                         parameters._seed, parameters._num_seeding_rounds);
+
+  Kokkos::Profiling::pushRegion("ArborX::KMeans::iterations");
+
+  Kokkos::View<Distance *, MemorySpace> upper(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                         "ArborX::KMeans::upper_bounds"),
+      n);
+  Kokkos::View<Distance *, MemorySpace> lower(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                         "ArborX::KMeans::lower_bounds"),
+      n);
+  Kokkos::View<Distance *, MemorySpace> half_separations(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                         "ArborX::KMeans::half_separations"),
+      num_clusters);
+  Kokkos::View<Distance *, MemorySpace> shifts(
+      "ArborX::KMeans::shifts", num_clusters);
+  Kokkos::View<Coordinate **, MemorySpace> sums("ArborX::KMeans::sums",
+                                                num_clusters, DIM);
+  Kokkos::View<int *, MemorySpace> counts("ArborX::KMeans::counts",
+                                          num_clusters);
+  Distance max_shift = 0;
+
+  using Tree = BoundingVolumeHierarchy<MemorySpace, PairValueIndex<Centroid>>;
+
+  int iteration = 0;
+  while (iteration < parameters._max_iterations)
+  {
+    Tree const tree(space, attach_indices(centroids));
+
+    Kokkos::parallel_for(
+        "ArborX::KMeans::half_separations",
+        Kokkos::RangePolicy(space, 0, num_clusters), KOKKOS_LAMBDA(int c) {
+          // The nearest centroid is c itself (or a duplicate)
+          int nearest;
+          Distance distance1;
+          Distance distance2;
+          Details::nearestTwoCentroids(tree, centroids(c), nearest, distance1,
+                                       distance2);
+          half_separations(c) = distance2 / 2;
+        });
+
+    int num_changed = 0;
+    Kokkos::parallel_reduce(
+        "ArborX::KMeans::assignment", Kokkos::RangePolicy(space, 0, n),
+        Details::KMeansAssignment<Points, Tree, Centroids, Labels,
+                                  decltype(upper)>{
+            points, tree, centroids, labels, upper, lower, half_separations,
+            shifts, max_shift, iteration == 0},
+        num_changed);
+    ++iteration;
+
+    // The centroids are the means of the clusters already
+    if (num_changed == 0)
+      break;
+
+    Kokkos::deep_copy(space, sums, 0);
+    Kokkos::deep_copy(space, counts, 0);
+    Kokkos::parallel_for(
+        "ArborX::KMeans::accumulate", Kokkos::RangePolicy(space, 0, n),
+        KOKKOS_LAMBDA(int i) {
+          int const label = labels(i);
+          auto const &point = points(i);
+          for (int d = 0; d < DIM; ++d)
+            Kokkos::atomic_add(&sums(label, d),
+                               static_cast<Coordinate>(point[d]));
+          Kokkos::atomic_inc(&counts(label));
+        });
+    Kokkos::parallel_reduce(
+        "ArborX::KMeans::update_centroids",
+        Kokkos::RangePolicy(space, 0, num_clusters),
+        KOKKOS_LAMBDA(int c, Distance &update) {
+          // Empty clusters keep their centroid
+          if (counts(c) == 0)
+          {
+            shifts(c) = 0;
+            return;
+          }
+          Centroid centroid = centroids(c);
+          for (int d = 0; d < DIM; ++d)
+            centroid[d] = sums(c, d) / counts(c);
+          shifts(c) = Details::distance(centroids(c), centroid);
+          centroids(c) = centroid;
+          if (shifts(c) > update)
+            update = shifts(c);
+        },
+        Kokkos::Max<Distance>(max_shift));
+
+    if (max_shift <= parameters._tolerance)
+      break;
+  }
+
+  Kokkos::Profiling::popRegion();
+
+  return iteration;
+}
+
+} // namespace ArborX::Experimental
+
+#endif
@@ -0,0 +1,111 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#ifndef ARBORX_LOCAL_OUTLIER_FACTOR_HPP
+#define ARBORX_LOCAL_OUTLIER_FACTOR_HPP
+
+#include <ArborX_LinearBVH.hpp>
+#include <detail/ArborX_AccessTraits.hpp>
+#include <detail/ArborX_AttachIndices.hpp>
+#include <detail/ArborX_LocalOutlierFactorHelpers.hpp>
+#include <detail/ArborX_MutualReachabilityDistance.hpp>
+#include <detail/ArborX_PredicateHelpers.hpp>
+#include <misc/ArborX_Exception.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Profiling_ScopedRegion.hpp>
+
+namespace ArborX::Experimental
+{
+
+// Local outlier factor (Breunig et al., 2000) of a set of points for a given
+// number of neighbors k:
+// - k_distances(i) is the distance from the point i to its k-th nearest
+//   neighbor (the point itself excluded), a density based anomaly score on
+//   its own;
+// - densities(i) is the local reachability density, the inverse of the mean
+//   reachability distance max(k_distances(o), d(i, o)) to its neighbors o;
+// - scores(i) is the ratio of the mean density of its neighbors to its own
+//   density. Inliers have scores close to 1, outliers significantly larger.
+//
+// The neighbors are recomputed by each pass instead of being stored, so that
+// the memory used is linear in the number of points regardless of k.
+template <class MemorySpace>
+struct LocalOutlierFactor
+{
+  using memory_space = MemorySpace;
+  static_assert(Kokkos::is_memory_space<MemorySpace>::value);
+
+  Kokkos::View<float *, MemorySpace> k_distances;
+  Kokkos::View<float *, MemorySpace> densities;
+  Kokkos::View<float *, MemorySpace> scores;
+
+  template <class ExecutionSpace, class Primitives>
+  LocalOutlierFactor(ExecutionSpace const &space, Primitives const &primitives,
+                     int k)
+      : k_distances("ArborX::LOF::k_distances",
+                    AccessTraits<Primitives>::size(primitives))
+      , densities("ArborX::LOF::densities",
+                  AccessTraits<Primitives>::size(primitives))
+      , scores("ArborX::LOF::scores",
+               AccessTraits<Primitives>::size(primitives))
+  {
+    Kokkos::Profiling::ScopedRegion guard("ArborX::LOF");
+
+    using Points = Details::AccessValues<Primitives>;
+    using Point = typename Points::value_type;
+    static_assert(GeometryTraits::is_point_v<Point>);
+
+    Points points{primitives}; // NOLINT
+
+    int const n = points.size();
+    ARBORX_ASSERT(k >= 1 && k < n);
+
+    Kokkos::Profiling::pushRegion("ArborX::LOF::construction");
+    BoundingVolumeHierarchy bvh(space, Experimental::attach_indices(points));
+    Kokkos::Profiling::popRegion();
+
+    // Each point is its own nearest neighbor
+    auto const predicates =
+        Experimental::attach_indices(Experimental::make_nearest(points, k + 1));
+
+    // Same as the core distances of the minimum spanning tree
+    Kokkos::Profiling::pushRegion("ArborX::LOF::compute_k_distances");
+    bvh.query(space, predicates,
+              Details::MaxDistance<Points, decltype(k_distances)>{
+                  points, k_distances});
+    Kokkos::Profiling::popRegion();
+
+    // The counts differ from k only when duplicate points prevent a point
+    // from being found among its own nearest neighbors
+    Kokkos::View<int *, MemorySpace> counts("ArborX::LOF::counts", n);
+
+    Kokkos::Profiling::pushRegion("ArborX::LOF::compute_densities");
+    bvh.query(space, predicates,
+              Details::ReachabilityDistanceSum<Points, decltype(k_distances),
+                                               decltype(densities),
+                                               decltype(counts)>{
+                  points, k_distances, densities, counts});
+    Details::invertMeanReachabilityDistances(space, densities, counts);
+    Kokkos::Profiling::popRegion();
+
+    Kokkos::Profiling::pushRegion("ArborX::LOF::compute_scores");
+    bvh.query(space, predicates,
+              Details::DensitySum<decltype(densities), decltype(scores)>{
+                  densities, scores});
+    Details::finalizeScores(space, scores, counts, densities);
+    Kokkos::Profiling::popRegion();
+  }
+};
+
+} // namespace ArborX::Experimental
+
+#endif
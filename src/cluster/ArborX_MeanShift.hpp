@@ -0,0 +1,312 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+#ifndef ARBORX_MEAN_SHIFT_HPP
+#define ARBORX_MEAN_SHIFT_HPP
+
+#include <ArborX_Downsampling.hpp>
+#include <ArborX_LinearBVH.hpp>
+#include <algorithms/ArborX_Convert.hpp>
+#include <algorithms/ArborX_Distance.hpp>
+#include <detail/ArborX_AccessTraits.hpp>
+#include <detail/ArborX_AttachIndices.hpp>
+#include <detail/ArborX_MeanShiftHelpers.hpp>
+#include <detail/ArborX_PredicateHelpers.hpp>
+#include <detail/ArborX_UnionFind.hpp>
+#include <kokkos_ext/ArborX_KokkosExtAccessibilityTraits.hpp>
+#include <kokkos_ext/ArborX_KokkosExtStdAlgorithms.hpp>
+#include <kokkos_ext/ArborX_KokkosExtViewHelpers.hpp>
+#include <misc/ArborX_Exception.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Profiling_ScopedRegion.hpp>
+
+#include <type_traits>
+#include <utility> // swap
+
+namespace ArborX::Experimental
+{
+
+namespace MeanShift
+{
+
+enum class Kernel
+{
+  flat,
+  gaussian
+};
+
+struct Parameters
+{
+  // Weights of the points in the means: uniform within the bandwidth (flat),
+  // or Gaussian with the bandwidth as the standard deviation
+  Kernel _kernel = Kernel::flat;
+  // Maximum number of iterations of a seed
+  int _max_iterations = 300;
+  // A seed has converged when it moves by less than this fraction of the
+  // bandwidth
+  float _tolerance = 1e-3f;
+  // Modes closer than this fraction of the bandwidth are merged
+  float _merge_ratio = 0.5f;
+  // Start from one point per cubic bin of the size of the bandwidth instead
+  // of from every point
+  bool _bin_seeding = false;
+
+  Parameters &setKernel(Kernel kernel)
+  {
+    _kernel = kernel;
+    return *this;
+  }
+  Parameters &setMaxIterations(int max_iterations)
+  {
+    _max_iterations = max_iterations;
+    return *this;
+  }
+  Parameters &setTolerance(float tolerance)
+  {
+    _tolerance = tolerance;
+    return *this;
+  }
+  Parameters &setMergeRatio(float merge_ratio)
+  {
+    _merge_ratio = merge_ratio;
+    return *this;
+  }
+  Parameters &setBinSeeding(bool bin_seeding)
+  {
+    _bin_seeding = bin_seeding;
+    return *this;
+  }
+};
+} // namespace MeanShift
+
+// Cluster the points with the mean-shift algorithm. Each seed repeatedly
+// moves to the mean of the points around it, weighted by the kernel, until it
+// converges to a mode of the density. The Gaussian kernel is truncated at
+// three bandwidths. On output, modes(c) is the mode of
+// the cluster c and labels(i) the cluster of the point i. Returns the number
+// of iterations.
+//
+// Each iteration fuses the radius search with the mean reduction, and only
+// processes the seeds that have not converged yet. The modes of the seeds are
+// then merged with union-find when they are close to each other.
+template <typename ExecutionSpace, typename Primitives, typename Labels,
+          typename Modes>
+int meanShift(ExecutionSpace const &space, Primitives const &primitives,
+              float bandwidth, Labels &labels, Modes &modes,
+              MeanShift::Parameters const &parameters = MeanShift::Parameters())
+{
+  Kokkos::Profiling::ScopedRegion guard("ArborX::MeanShift");
+
+  namespace KokkosExt = ArborX::Details::KokkosExt;
+
+  Details::check_valid_access_traits(primitives);
+  using Points = Details::AccessValues<Primitives>;
+  using MemorySpace = typename Points::memory_space;
+  static_assert(
+      KokkosExt::is_accessible_from<MemorySpace, ExecutionSpace>::value,
+      "Primitives must be accessible from the execution space");
+  static_assert(Kokkos::is_view_v<Labels> && Kokkos::is_view_v<Modes>);
+  static_assert(std::is_same_v<typename Labels::memory_space, MemorySpace>);
+  static_assert(std::is_same_v<typename Modes::memory_space, MemorySpace>);
+
+  using Point = typename Points::value_type;
+  using Mode = typename Modes::value_type;
+  static_assert(GeometryTraits::is_point_v<Point>);
+  static_assert(GeometryTraits::is_point_v<Mode>);
+  static_assert(GeometryTraits::dimension_v<Mode> ==
+                GeometryTraits::dimension_v<Point>);
+
+#ifdef KOKKOS_ENABLE_SERIAL
+  using UnionFind = Details::UnionFind<
+      MemorySpace,
+      /*DoSerial=*/std::is_same_v<ExecutionSpace, Kokkos::Serial>>;
+#else
+  using UnionFind = Details::UnionFind<MemorySpace>;
+#endif
+
+  ARBORX_ASSERT(bandwidth > 0);
+  ARBORX_ASSERT(parameters._max_iterations >= 0);
+
+  Points points{primitives}; // NOLINT
+  int const n = points.size();
+
+  KokkosExt::reallocWithoutInitializing(space, labels, n);
+  if (n == 0)
+  {
+    KokkosExt::reallocWithoutInitializing(space, modes, 0);
+    return 0;
+  }
+
+  Kokkos::Profiling::pushRegion("ArborX::MeanShift::construction");
+  BoundingVolumeHierarchy bvh(space, attach_indices(points));
+  Kokkos::Profiling::popRegion();
+
+  Kokkos::Profiling::pushRegion("ArborX::MeanShift::seeding");
+  Kokkos::View<int *, MemorySpace> seeds("ArborX::MeanShift::seeds", 0);
+  if (parameters._bin_seeding)
+  {
+    voxelDownsample(space, primitives, bandwidth, seeds);
+  }
+  else
+  {
+    KokkosExt::reallocWithoutInitializing(space, seeds, n);
+    KokkosExt::iota(space, seeds);
+  }
+  int const num_seeds = seeds.size();
+
+  Kokkos::View<Mode *, MemorySpace> seed_modes(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                         "ArborX::MeanShift::seed_modes"),
+      num_seeds);
+  Kokkos::parallel_for(
+      "ArborX::MeanShift::initialize_modes",
+      Kokkos::RangePolicy(space, 0, num_seeds), KOKKOS_LAMBDA(int s) {
+        seed_modes(s) = Details::convert<Mode>(points(seeds(s)));
+      });
+  Kokkos::Profiling::popRegion();
+
+  Kokkos::Profiling::pushRegion("ArborX::MeanShift::iterations");
+
+  // Indices of the seeds that have not converged yet
+  Kokkos::View<int *, MemorySpace> active(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                         "ArborX::MeanShift::active"),
+      num_seeds);
+  KokkosExt::iota(space, active);
+  auto remaining =
+      KokkosExt::cloneWithoutInitializingNorCopying(space, active);
+  Kokkos::View<int *, MemorySpace> moved(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                         "ArborX::MeanShift::moved"),
+      num_seeds);
+
+  float const tolerance = parameters._tolerance * bandwidth;
+  bool const gaussian = (parameters._kernel == MeanShift::Kernel::gaussian);
+  int num_active = num_seeds;
+  int iteration = 0;
+  while (num_active > 0 && iteration < parameters._max_iterations)
+  {
+    auto const current =
+        Kokkos::subview(active, Kokkos::make_pair(0, num_active));
+    Kokkos::parallel_for(
+        "ArborX::MeanShift::shift", Kokkos::RangePolicy(space, 0, num_active),
+        KOKKOS_LAMBDA(int k) {
+          int const s = current(k);
+          auto const mode = seed_modes(s);
+          auto mean = mode;
+          if (gaussian)
+            Details::meanShiftMean(bvh, mode, bandwidth,
+                                   Details::MeanShiftGaussianKernel{bandwidth},
+                                   mean);
+          else
+            Details::meanShiftMean(bvh, mode, bandwidth,
+                                   Details::MeanShiftFlatKernel{}, mean);
+          moved(s) = (Details::distance(mode, mean) > tolerance);
+          seed_modes(s) = mean;
+        });
+    ++iteration;
+
+    // Retire the converged seeds from the next iterations
+    int num_remaining;
+    Kokkos::parallel_scan(
+        "ArborX::MeanShift::compact", Kokkos::RangePolicy(space, 0, num_active),
+        KOKKOS_LAMBDA(int k, int &update, bool final_pass) {
+          int const s = current(k);
+          if (!moved(s))
+            return;
+          if (final_pass)
+            remaining(update) = s;
+          ++update;
+        },
+        num_remaining);
+    std::swap(active, remaining);
+    num_active = num_remaining;
+  }
+
+  Kokkos::Profiling::popRegion();
+
+  Kokkos::Profiling::pushRegion("ArborX::MeanShift::merge_modes");
+
+  Kokkos::View<int *, MemorySpace> mode_labels(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                         "ArborX::MeanShift::mode_labels"),
+      num_seeds);
+  KokkosExt::iota(space, mode_labels);
+  {
+    BoundingVolumeHierarchy mode_tree(space, attach_indices(seed_modes));
+    mode_tree.query(space,
+                    attach_indices(make_intersects(
+                        seed_modes, parameters._merge_ratio * bandwidth)),
+                    Details::MeanShiftMergeModes<UnionFind>{
+                        UnionFind{mode_labels}});
+  }
+
+  // Point every seed to its representative, which is the seed with the
+  // smallest index among the merged ones, and number the representatives
+  Kokkos::View<int *, MemorySpace> cluster_indices(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                         "ArborX::MeanShift::cluster_indices"),
+      num_seeds);
+  Kokkos::parallel_for(
+      "ArborX::MeanShift::finalize_labels",
+      Kokkos::RangePolicy(space, 0, num_seeds), KOKKOS_LAMBDA(int s) {
+        int next;
+        int representative = mode_labels(s);
+        while (representative > (next = mode_labels(representative)))
+          representative = next;
+        mode_labels(s) = representative;
+      });
+  int num_clusters;
+  Kokkos::parallel_scan(
+      "ArborX::MeanShift::number_clusters",
+      Kokkos::RangePolicy(space, 0, num_seeds),
+      KOKKOS_LAMBDA(int s, int &update, bool final_pass) {
+        if (mode_labels(s) != s)
+          return;
+        if (final_pass)
+          cluster_indices(s) = update;
+        ++update;
+      },
+      num_clusters);
+
+  KokkosExt::reallocWithoutInitializing(space, modes, num_clusters);
+  Kokkos::parallel_for(
+      "ArborX::MeanShift::gather_modes",
+      Kokkos::RangePolicy(space, 0, num_seeds), KOKKOS_LAMBDA(int s) {
+        if (mode_labels(s) == s)
+          modes(cluster_indices(s)) = seed_modes(s);
+      });
+
+  Kokkos::Profiling::popRegion();
+
+  Kokkos::Profiling::pushRegion("ArborX::MeanShift::labels");
+  if (!parameters._bin_seeding)
+  {
+    // Every point is a seed, and belongs to the cluster of its mode
+    Kokkos::parallel_for(
+        "ArborX::MeanShift::seed_labels", Kokkos::RangePolicy(space, 0, n),
+        KOKKOS_LAMBDA(int i) { labels(i) = cluster_indices(mode_labels(i)); });
+  }
+  else
+  {
+    // The points belong to the cluster of the nearest mode
+    BoundingVolumeHierarchy mode_tree(space, attach_indices(modes));
+    mode_tree.query(space, attach_indices(make_nearest(primitives, 1)),
+                    Details::MeanShiftNearestMode<Labels>{labels});
+  }
+  Kokkos::Profiling::popRegion();
+
+  return iteration;
+}
+
+} // namespace ArborX::Experimental
+
+#endif
@@ -0,0 +1,103 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#ifndef ARBORX_DOWNSAMPLING_HELPERS_HPP
+#define ARBORX_DOWNSAMPLING_HELPERS_HPP
+
+#include <detail/ArborX_Callbacks.hpp>
+#include <detail/ArborX_Predicates.hpp>
+
+#include <Kokkos_Macros.hpp>
+
+namespace ArborX::Details
+{
+
+enum class DownsamplingState : char
+{
+  undecided,
+  selected,
+  removed
+};
+
+// Random but reproducible priority of the point i (murmur3 finalizer)
+KOKKOS_INLINE_FUNCTION unsigned downsamplingPriority(unsigned i,
+                                                     unsigned seed)
+{
+  unsigned h = i ^ (seed * 0x9e3779b9u);
+  h ^= h >> 16;
+  h *= 0x85ebca6bu;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35u;
+  h ^= h >> 16;
+  return h;
+}
+
+// The point i has a lower priority than the point j. Ties are broken by the
+// indices so that the order is total.
+KOKKOS_INLINE_FUNCTION bool hasLowerPriority(int i, int j, unsigned seed)
+{
+  auto const priority_i = downsamplingPriority(i, seed);
+  auto const priority_j = downsamplingPriority(j, seed);
+  return priority_i < priority_j || (priority_i == priority_j && i < j);
+}
+
+// Clear the flag of the query point if an undecided neighbor has a higher
+// priority. The undecided points whose flag survives are local maxima, and
+// can be selected together.
+template <typename States, typename Flags>
+struct MISLocalMaximum
+{
+  States _states;
+  Flags _flags;
+  unsigned _seed;
+
+  template <typename Predicate, typename Value>
+  KOKKOS_FUNCTION auto operator()(Predicate const &predicate,
+                                  Value const &value) const
+  {
+    int const i = getData(predicate);
+    int const j = value.index;
+    if (i != j && _states(j) == DownsamplingState::undecided &&
+        hasLowerPriority(i, j, _seed))
+    {
+      _flags(i) = 0;
+      return CallbackTreeTraversalControl::early_exit;
+    }
+    return CallbackTreeTraversalControl::normal_continuation;
+  }
+};
+
+// Flag the query point if one of its neighbors was selected
+template <typename States, typename Flags>
+struct MISSelectedNeighbor
+{
+  States _states;
+  Flags _flags;
+
+  template <typename Predicate, typename Value>
+  KOKKOS_FUNCTION auto operator()(Predicate const &predicate,
+                                  Value const &value) const
+  {
+    int const i = getData(predicate);
+    int const j = value.index;
+    if (_states(i) != DownsamplingState::selected &&
+        _states(j) == DownsamplingState::selected)
+    {
+      _flags(i) = 1;
+      return CallbackTreeTraversalControl::early_exit;
+    }
+    return CallbackTreeTraversalControl::normal_continuation;
+  }
+};
+
+} // namespace ArborX::Details
+
+#endif
@@ -0,0 +1,349 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+#ifndef ARBORX_DETAILS_KMEANS_HELPERS_HPP
+#define ARBORX_DETAILS_KMEANS_HELPERS_HPP
+
+#include <ArborX_LinearBVH.hpp>
+#include <algorithms/ArborX_Distance.hpp>
+#include <detail/ArborX_AttachIndices.hpp>
+#include <detail/ArborX_HappyTreeFriends.hpp>
+#include <detail/ArborX_Node.hpp> // ROPE_SENTINEL
+#include <detail/ArborX_PointSetDistances.hpp> // updateNearest
+#include <kokkos_ext/ArborX_KokkosExtArithmeticTraits.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Profiling_ScopedRegion.hpp>
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <vector>
+
+namespace ArborX::Details
+{
+
+// Counter-based pseudo-random number in [0, 1) (SplitMix64 finalizer), so
+// that every point draws its own number without a shared generator state
+KOKKOS_INLINE_FUNCTION float kmeansRandom(unsigned long long seed,
+                                          unsigned long long counter)
+{
+  unsigned long long z = seed + (counter + 1) * 0x9e3779b97f4a7c15ULL;
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  z ^= (z >> 31);
+  return (z >> 40) * (1.f / (1 << 24));
+}
+
+// Find the nearest and second nearest centroids of a point
+template <class Tree, class Point, class Distance>
+KOKKOS_FUNCTION void nearestTwoCentroids(Tree const &tree, Point const &point,
+                                         int &nearest, Distance &distance1,
+                                         Distance &distance2)
+{
+  distance1 = KokkosExt::ArithmeticTraits::infinity<Distance>::value;
+  distance2 = distance1;
+  nearest = -1;
+
+  auto check_leaf = [&](int leaf) {
+    auto const d =
+        Details::distance(point, HappyTreeFriends::getIndexable(tree, leaf));
+    if (d < distance1)
+    {
+      distance2 = distance1;
+      distance1 = d;
+      nearest = HappyTreeFriends::getValue(tree, leaf).index;
+    }
+    else if (d < distance2)
+    {
+      distance2 = d;
+    }
+  };
+
+  if (tree.size() == 1)
+  {
+    check_leaf(0);
+    return;
+  }
+
+  int node = HappyTreeFriends::getRoot(tree);
+  do
+  {
+    if (HappyTreeFriends::isLeaf(tree, node))
+    {
+      check_leaf(node);
+      node = HappyTreeFriends::getRope(tree, node);
+    }
+    else
+    {
+      auto const &bounding_volume =
+          HappyTreeFriends::getInternalBoundingVolume(tree, node);
+      node = (Details::distance(point, bounding_volume) < distance2
+                  ? HappyTreeFriends::getLeftChild(tree, node)
+                  : HappyTreeFriends::getRope(tree, node));
+    }
+  } while (node != ROPE_SENTINEL);
+}
+
+// Assign the points to their nearest centroid, skipping the points whose
+// bounds prove that the assignment cannot change. Each point keeps an upper
+// bound on the distance to its centroid and a lower bound on the distance to
+// any other centroid (a single lower bound as in Hamerly's variant of Elkan's
+// algorithm, to keep the memory linear in the number of points). When
+// centroids move, the bounds are loosened by the shift of the point's
+// centroid and by the largest shift. The assignment holds if the upper bound
+// does not exceed either the lower bound or half the distance from the
+// centroid to the nearest other centroid.
+template <class Points, class Tree, class Centroids, class Labels,
+          class Bounds>
+struct KMeansAssignment
+{
+  using Distance = typename Bounds::non_const_value_type;
+
+  Points _points;
+  Tree _tree;
+  Centroids _centroids;
+  Labels _labels;
+  Bounds _upper;
+  Bounds _lower;
+  Bounds _half_separations;
+  Bounds _shifts;
+  Distance _max_shift;
+  bool _initial;
+
+  KOKKOS_FUNCTION void operator()(int i, int &num_changed) const
+  {
+    auto const &point = _points(i);
+    if (!_initial)
+    {
+      int const label = _labels(i);
+      auto upper = _upper(i) + _shifts(label);
+      auto const lower = _lower(i) - _max_shift;
+      auto const bound = Kokkos::max(lower, _half_separations(label));
+      if (upper > bound)
+        upper = Details::distance(point, _centroids(label));
+      if (upper <= bound)
+      {
+        _upper(i) = upper;
+        _lower(i) = lower;
+        return;
+      }
+    }
+
+    int nearest;
+    Distance distance1;
+    Distance distance2;
+    nearestTwoCentroids(_tree, point, nearest, distance1, distance2);
+    if (_initial || nearest != _labels(i))
+      ++num_changed;
+    _labels(i) = nearest;
+    _upper(i) = distance1;
+    _lower(i) = distance2;
+  }
+};
+
+// Copy the points with the given indices (in [begin, end))
+template <class Centroid, class ExecutionSpace, class Points, class Indices>
+auto kmeansGather(ExecutionSpace const &space, Points const &points,
+                  Indices const &indices, int begin, int end)
+{
+  using MemorySpace = typename Indices::memory_space;
+  constexpr int DIM = GeometryTraits::dimension_v<Centroid>;
+  Kokkos::View<Centroid *, MemorySpace> gathered(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                         "ArborX::KMeans::gathered_points"),
+      end - begin);
+  Kokkos::parallel_for(
+      "ArborX::KMeans::gather_points", Kokkos::RangePolicy(space, begin, end),
+      KOKKOS_LAMBDA(int c) {
+        auto const &point = points(indices(c));
+        for (int d = 0; d < DIM; ++d)
+          gathered(c - begin)[d] = point[d];
+      });
+  return gathered;
+}
+
+// Seeding with the scalable variant of k-means++ (k-means||). In each round,
+// every point is sampled independently with a probability proportional to its
+// squared distance to the current candidates. The distances are updated with
+// a hierarchy over the candidates added in the round only. The candidates are
+// then weighted by the number of points closest to them, and reduced to k
+// centroids with a weighted k-means++ on the host.
+template <class ExecutionSpace, class Points, class Centroids>
+void kmeansSeeding(ExecutionSpace const &space, Points const &points,
+                   int num_clusters, Centroids &centroids,
+                   unsigned long long seed, int num_rounds)
+{
+  Kokkos::Profiling::ScopedRegion guard("ArborX::KMeans::seeding");
+
+  using MemorySpace = typename Centroids::memory_space;
+  using Centroid = typename Centroids::value_type;
+  using Distance = decltype(Details::distance(std::declval<Centroid>(),
+                                              std::declval<Centroid>()));
+  using Tree = BoundingVolumeHierarchy<MemorySpace, PairValueIndex<Centroid>>;
+
+  int const n = points.size();
+  int const oversampling = 2 * num_clusters;
+
+  // The candidates are stored as indices of the points
+  Kokkos::View<int *, MemorySpace> candidates(
+      "ArborX::KMeans::candidates", 1);
+  Kokkos::deep_copy(space, candidates, static_cast<int>(seed % n));
+
+  Kokkos::View<Distance *, MemorySpace> distances(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                         "ArborX::KMeans::candidate_distances"),
+      n);
+  Kokkos::deep_copy(space, distances,
+                    KokkosExt::ArithmeticTraits::infinity<Distance>::value);
+
+  int begin = 0;
+  int end = 1;
+  for (int round = 0; round < num_rounds && begin < end; ++round)
+  {
+    auto const new_candidates =
+        kmeansGather<Centroid>(space, points, candidates, begin, end);
+    Tree const tree(space, Experimental::attach_indices(new_candidates));
+    Distance phi = 0;
+    Kokkos::parallel_reduce(
+        "ArborX::KMeans::update_candidate_distances",
+        Kokkos::RangePolicy(space, 0, n),
+        KOKKOS_LAMBDA(int i, Distance &update) {
+          int index = -1;
+          updateNearest(tree, points(i), distances(i), index, Distance(0));
+          update += distances(i) * distances(i);
+        },
+        phi);
+    if (!(phi > 0))
+      break;
+
+    unsigned long long const offset =
+        static_cast<unsigned long long>(round) * n;
+    int num_sampled = 0;
+    Kokkos::parallel_reduce(
+        "ArborX::KMeans::count_samples", Kokkos::RangePolicy(space, 0, n),
+        KOKKOS_LAMBDA(int i, int &update) {
+          if (kmeansRandom(seed, offset + i) <
+              oversampling * distances(i) * distances(i) / phi)
+            ++update;
+        },
+        num_sampled);
+
+    begin = end;
+    end += num_sampled;
+    Kokkos::resize(Kokkos::view_alloc(space, Kokkos::WithoutInitializing),
+                   candidates, end);
+    Kokkos::parallel_scan(
+        "ArborX::KMeans::append_samples", Kokkos::RangePolicy(space, 0, n),
+        KOKKOS_LAMBDA(int i, int &update, bool final) {
+          if (kmeansRandom(seed, offset + i) <
+              oversampling * distances(i) * distances(i) / phi)
+          {
+            if (final)
+              candidates(begin + update) = i;
+            ++update;
+          }
+        });
+  }
+
+  int const num_candidates = end;
+  auto const candidate_points =
+      kmeansGather<Centroid>(space, points, candidates, 0, num_candidates);
+  Kokkos::View<int *, MemorySpace> weights("ArborX::KMeans::candidate_weights",
+                                           num_candidates);
+  {
+    Tree const tree(space, Experimental::attach_indices(candidate_points));
+    Kokkos::parallel_for(
+        "ArborX::KMeans::weigh_candidates", Kokkos::RangePolicy(space, 0, n),
+        KOKKOS_LAMBDA(int i) {
+          auto distance =
+              KokkosExt::ArithmeticTraits::infinity<Distance>::value;
+          int index = -1;
+          updateNearest(tree, points(i), distance, index, Distance(0));
+          Kokkos::atomic_inc(&weights(index));
+        });
+  }
+
+  auto const candidates_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, candidates);
+  auto const points_host = Kokkos::create_mirror_view_and_copy(
+      Kokkos::HostSpace{}, candidate_points);
+  auto const weights_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, weights);
+
+  // Weighted k-means++ over the candidates
+  std::mt19937_64 generator(seed);
+  std::uniform_real_distribution<double> uniform;
+  auto sample = [&](std::vector<double> const &probabilities) {
+    double total = 0;
+    for (auto p : probabilities)
+      total += p;
+    if (!(total > 0))
+      return -1;
+    double r = uniform(generator) * total;
+    int const m = probabilities.size();
+    for (int c = 0; c < m; ++c)
+    {
+      r -= probabilities[c];
+      if (r < 0 && probabilities[c] > 0)
+        return c;
+    }
+    for (int c = m - 1; c >= 0; --c)
+      if (probabilities[c] > 0)
+        return c;
+    return -1;
+  };
+
+  std::vector<int> chosen;
+  std::set<int> chosen_points;
+  std::vector<double> min_distances(
+      num_candidates, KokkosExt::ArithmeticTraits::infinity<double>::value);
+  std::vector<double> probabilities(weights_host.data(),
+                                    weights_host.data() + num_candidates);
+  while ((int)chosen.size() < num_clusters)
+  {
+    int const c = sample(probabilities);
+    if (c < 0)
+      break;
+    chosen.push_back(c);
+    chosen_points.insert(candidates_host(c));
+    for (int j = 0; j < num_candidates; ++j)
+    {
+      double const d = Details::distance(points_host(c), points_host(j));
+      min_distances[j] = std::min(min_distances[j], d * d);
+      probabilities[j] = weights_host(j) * min_distances[j];
+    }
+  }
+
+  // Without enough distinct candidates (e.g., with many duplicate points),
+  // the remaining centroids are evenly spaced points
+  std::vector<int> indices;
+  for (auto c : chosen)
+    indices.push_back(candidates_host(c));
+  for (long long j = 0; (int)indices.size() < num_clusters; ++j)
+  {
+    int const i = (j * n / num_clusters + j / num_clusters) % n;
+    if (chosen_points.insert(i).second)
+      indices.push_back(i);
+  }
+
+  auto const indices_view = Kokkos::create_mirror_view_and_copy(
+      MemorySpace{},
+      Kokkos::View<int *, Kokkos::HostSpace,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>(indices.data(),
+                                                            num_clusters));
+  auto const seeds = kmeansGather<Centroid>(space, points, indices_view, 0,
+                                            num_clusters);
+  Kokkos::deep_copy(space, centroids, seeds);
+}
+
+} // namespace ArborX::Details
+
+#endif
@@ -0,0 +1,108 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#ifndef ARBORX_LOCAL_OUTLIER_FACTOR_HELPERS_HPP
+#define ARBORX_LOCAL_OUTLIER_FACTOR_HELPERS_HPP
+
+#include <algorithms/ArborX_Distance.hpp>
+#include <detail/ArborX_Predicates.hpp>
+
+#include <Kokkos_Core.hpp>
+
+namespace ArborX::Details
+{
+
+// Sum of the reachability distances from the query point j to its
+// neighbors, reach-dist(j, i) = max(k-distance(i), d(j, i)). The query point
+// is found among its own nearest neighbors and skipped.
+template <class Primitives, class KDistances, class Sums, class Counts>
+struct ReachabilityDistanceSum
+{
+  Primitives _primitives;
+  KDistances _k_distances;
+  Sums _sums;
+  Counts _counts;
+
+  using memory_space = typename Primitives::memory_space;
+  using size_type = typename memory_space::size_type;
+
+  template <class Predicate, typename Value>
+  KOKKOS_FUNCTION void operator()(Predicate const &predicate,
+                                  Value const &value) const
+  {
+    size_type const i = value.index;
+    size_type const j = getData(predicate);
+    if (i == j)
+      return;
+    using Kokkos::max;
+    auto const distance_ij = distance(_primitives(i), _primitives(j));
+    // NOTE each nearest predicate traversal is performed by a single thread,
+    // same as for MaxDistance
+    _sums(j) += max(_k_distances(i), distance_ij);
+    ++_counts(j);
+  }
+};
+
+// Sum of the local reachability densities of the neighbors of the query
+// point j
+template <class Densities, class Sums>
+struct DensitySum
+{
+  Densities _densities;
+  Sums _sums;
+
+  using memory_space = typename Densities::memory_space;
+  using size_type = typename memory_space::size_type;
+
+  template <class Predicate, typename Value>
+  KOKKOS_FUNCTION void operator()(Predicate const &predicate,
+                                  Value const &value) const
+  {
+    size_type const i = value.index;
+    size_type const j = getData(predicate);
+    if (i == j)
+      return;
+    _sums(j) += _densities(i);
+  }
+};
+
+// Turn the sums of reachability distances into the local reachability
+// densities, the inverses of their means
+template <class ExecutionSpace, class Densities, class Counts>
+void invertMeanReachabilityDistances(ExecutionSpace const &space,
+                                     Densities const &densities,
+                                     Counts const &counts)
+{
+  Kokkos::parallel_for(
+      "ArborX::LOF::invert_mean_reachability_distances",
+      Kokkos::RangePolicy(space, 0, densities.extent(0)),
+      KOKKOS_LAMBDA(int i) {
+        // Avoid an infinite density when at least k points are duplicates
+        densities(i) = 1 / (densities(i) / counts(i) + 1e-10f);
+      });
+}
+
+// Turn the sums of the densities of the neighbors into the ratios of their
+// means to the densities of the points
+template <class ExecutionSpace, class Scores, class Counts, class Densities>
+void finalizeScores(ExecutionSpace const &space, Scores const &scores,
+                    Counts const &counts, Densities const &densities)
+{
+  Kokkos::parallel_for(
+      "ArborX::LOF::finalize_scores",
+      Kokkos::RangePolicy(space, 0, scores.extent(0)), KOKKOS_LAMBDA(int i) {
+        scores(i) /= counts(i) * densities(i);
+      });
+}
+
+} // namespace ArborX::Details
+
+#endif
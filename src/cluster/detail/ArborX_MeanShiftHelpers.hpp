@@ -0,0 +1,142 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+#ifndef ARBORX_DETAILS_MEAN_SHIFT_HELPERS_HPP
+#define ARBORX_DETAILS_MEAN_SHIFT_HELPERS_HPP
+
+#include <ArborX_GeometryTraits.hpp>
+#include <algorithms/ArborX_Distance.hpp>
+#include <detail/ArborX_Callbacks.hpp>
+#include <detail/ArborX_HappyTreeFriends.hpp>
+#include <detail/ArborX_Node.hpp> // ROPE_SENTINEL
+#include <detail/ArborX_Predicates.hpp>
+
+#include <Kokkos_Core.hpp>
+
+namespace ArborX::Details
+{
+
+// Weights of the points within the bandwidth of the center
+struct MeanShiftFlatKernel
+{
+  // The kernel vanishes past the bandwidth
+  static constexpr float cutoff = 1.f;
+
+  KOKKOS_FUNCTION float operator()(float /*distance*/) const { return 1.f; }
+};
+
+// Gaussian weights, with the bandwidth as the standard deviation
+struct MeanShiftGaussianKernel
+{
+  // The points further than three bandwidths, weighing less than 1.2% of
+  // the center, are ignored
+  static constexpr float cutoff = 3.f;
+
+  float _bandwidth;
+
+  KOKKOS_FUNCTION float operator()(float distance) const
+  {
+    float const r = distance / _bandwidth;
+    return Kokkos::exp(-r * r / 2);
+  }
+};
+
+// Weighted mean of the points of the tree within the cutoff of the kernel,
+// with the radius search and the reduction fused in a single traversal so
+// that the neighbors are never stored. Returns the number of points averaged;
+// the mean is left unchanged if there are none.
+template <class BVH, class Point, class Kernel>
+KOKKOS_FUNCTION int meanShiftMean(BVH const &bvh, Point const &center,
+                                  float bandwidth, Kernel const &kernel,
+                                  Point &mean)
+{
+  constexpr int DIM = GeometryTraits::dimension_v<Point>;
+  using Coordinate = GeometryTraits::coordinate_type_t<Point>;
+
+  float const radius = Kernel::cutoff * bandwidth;
+  Coordinate sum[DIM] = {};
+  Coordinate total_weight = 0;
+  int count = 0;
+  auto check_leaf = [&](int leaf) {
+    auto const &point = HappyTreeFriends::getIndexable(bvh, leaf);
+    auto const distance = Details::distance(center, point);
+    if (distance <= radius)
+    {
+      Coordinate const weight = kernel(distance);
+      for (int d = 0; d < DIM; ++d)
+        sum[d] += weight * point[d];
+      total_weight += weight;
+      ++count;
+    }
+  };
+
+  if (bvh.size() == 1)
+    check_leaf(0);
+  else
+  {
+    int node = HappyTreeFriends::getRoot(bvh);
+    do
+    {
+      if (HappyTreeFriends::isLeaf(bvh, node))
+      {
+        check_leaf(node);
+        node = HappyTreeFriends::getRope(bvh, node);
+      }
+      else
+      {
+        auto const &bounding_volume =
+            HappyTreeFriends::getInternalBoundingVolume(bvh, node);
+        node = (Details::distance(center, bounding_volume) <= radius
+                    ? HappyTreeFriends::getLeftChild(bvh, node)
+                    : HappyTreeFriends::getRope(bvh, node));
+      }
+    } while (node != ROPE_SENTINEL);
+  }
+
+  if (total_weight > 0)
+    for (int d = 0; d < DIM; ++d)
+      mean[d] = sum[d] / total_weight;
+  return count;
+}
+
+// Merge the modes closer than the merge distance
+template <typename UnionFind>
+struct MeanShiftMergeModes
+{
+  UnionFind _union_find;
+
+  template <typename Predicate, typename Value>
+  KOKKOS_FUNCTION void operator()(Predicate const &predicate,
+                                  Value const &value) const
+  {
+    int const i = getData(predicate);
+    int const j = value.index;
+    if (i != j)
+      _union_find.merge(i, j);
+  }
+};
+
+// Label the query point with its nearest mode
+template <typename Labels>
+struct MeanShiftNearestMode
+{
+  Labels _labels;
+
+  template <typename Predicate, typename Value>
+  KOKKOS_FUNCTION void operator()(Predicate const &predicate,
+                                  Value const &value) const
+  {
+    _labels(getData(predicate)) = value.index;
+  }
+};
+
+} // namespace ArborX::Details
+
+#endif
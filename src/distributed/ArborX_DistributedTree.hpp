@@ -19,6 +19,7 @@
 #include <detail/ArborX_DistributedTreeSpatial.hpp>
 #include <detail/ArborX_PairValueIndex.hpp>
 #include <kokkos_ext/ArborX_KokkosExtStdAlgorithms.hpp>
+#include <kokkos_ext/ArborX_KokkosExtViewHelpers.hpp>
 
 #include <Kokkos_Core.hpp>
 
@@ -66,6 +67,14 @@ public:
   // Indicate whether the tree is empty on all processes
   bool empty() const noexcept { return size() == 0; }
 
+  // Return the number of bytes allocated on this process for the local tree,
+  // the replicated top tree and the sizes of the local trees
+  std::size_t memory_footprint() const noexcept
+  {
+    return _bottom_tree.memory_footprint() + _top_tree.memory_footprint() +
+           Details::KokkosExt::memorySpan(_bottom_tree_sizes);
+  }
+
   // Find objects satisfying the passed predicates (e.g. nearest to some point
   // or intersecting with some box)
   //
@@ -186,6 +186,10 @@ void DistributedTreeImpl::queryDispatch2RoundImpl(
   Kokkos::Profiling::ScopedRegion guard(prefix);
 
   static_assert(is_constrained_callback_v<Callback>);
+  static_assert(
+      std::is_same_v<std::decay_t<decltype(getMetric(predicates(0)))>,
+                     Experimental::Euclidean>,
+      "Distributed nearest queries only support the Euclidean metric");
 
   if (tree.empty())
   {
@@ -35,6 +35,11 @@ DistributedTreeImpl::queryDispatch(SpatialPredicateTag, Tree const &tree,
 {
   Kokkos::Profiling::ScopedRegion guard(
       "ArborX::DistributedTree::query::spatial");
+  static_assert(
+      !Kokkos::is_detected<PredicateOverlapsSubtreeArchetypeExpression,
+                           typename Predicates::value_type,
+                           typename Tree::bounding_volume_type>{},
+      "Distributed spatial queries do not support within predicates");
 
   if (tree.empty())
   {
@@ -68,6 +73,11 @@ void DistributedTreeImpl::queryDispatch(SpatialPredicateTag, Tree const &tree,
   std::string prefix = "ArborX::DistributedTree::query::spatial(pure)";
 
   Kokkos::Profiling::ScopedRegion guard(prefix);
+  static_assert(
+      !Kokkos::is_detected<PredicateOverlapsSubtreeArchetypeExpression,
+                           typename Predicates::value_type,
+                           typename Tree::bounding_volume_type>{},
+      "Distributed spatial queries do not support within predicates");
 
   if (tree.empty())
     return;
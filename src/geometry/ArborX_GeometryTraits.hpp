@@ -14,6 +14,8 @@
 #include <Kokkos_DetectionIdiom.hpp>
 #include <Kokkos_Macros.hpp>
 
+#include <type_traits>
+
 namespace ArborX
 {
 
@@ -66,6 +68,8 @@ DEFINE_GEOMETRY(tetrahedron, TetrahedronTag);
 DEFINE_GEOMETRY(ray, RayTag);
 DEFINE_GEOMETRY(segment, SegmentTag);
 DEFINE_GEOMETRY(ellipsoid, EllipsoidTag);
+DEFINE_GEOMETRY(spherical_cap, SphericalCapTag);
+DEFINE_GEOMETRY(spatio_temporal, SpatioTemporalTag);
 #undef DEFINE_GEOMETRY
 
 template <typename Geometry>
@@ -73,7 +77,18 @@ inline constexpr bool is_valid_geometry =
     (is_point_v<Geometry> || is_box_v<Geometry> || is_sphere_v<Geometry> ||
      is_kdop_v<Geometry> || is_triangle_v<Geometry> ||
      is_tetrahedron_v<Geometry> || is_ray_v<Geometry> ||
-     is_segment_v<Geometry> || is_ellipsoid_v<Geometry>);
+     is_segment_v<Geometry> || is_ellipsoid_v<Geometry> ||
+     is_spherical_cap_v<Geometry> || is_spatio_temporal_v<Geometry>);
+
+// Type used for arithmetic on coordinates. Coordinates stored in a
+// floating-point format narrower than float (e.g., Kokkos::Experimental::half_t
+// or bhalf_t) are widened to float, so that distances are accumulated in
+// single precision.
+template <typename Coordinate>
+using computation_type_t =
+    std::conditional_t<!std::is_integral_v<Coordinate> &&
+                           (sizeof(Coordinate) < sizeof(float)),
+                       float, Coordinate>;
 
 template <typename Geometry>
 using DimensionNotSpecializedArchetypeAlias =
@@ -121,9 +136,10 @@ void check_valid_geometry_traits(Geometry const &)
                 "GeometryTraits::coordinate_type<Geometry> must define 'type' "
                 "member type");
   using Coordinate = coordinate_type_t<Geometry>;
-  static_assert(
-      std::is_arithmetic_v<Coordinate>,
-      "GeometryTraits::coordinate_type<Geometry> must be an arithmetic type");
+  static_assert(std::is_arithmetic_v<Coordinate> ||
+                    std::is_constructible_v<float, Coordinate>,
+                "GeometryTraits::coordinate_type<Geometry> must be an "
+                "arithmetic or a reduced precision floating-point type");
 }
 
 } // namespace GeometryTraits
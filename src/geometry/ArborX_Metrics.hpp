@@ -0,0 +1,378 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+#ifndef ARBORX_METRICS_HPP
+#define ARBORX_METRICS_HPP
+
+#include <ArborX_GeometryTraits.hpp>
+#include <algorithms/ArborX_Distance.hpp>
+
+#include <Kokkos_Assert.hpp>
+#include <Kokkos_Clamp.hpp>
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_MathematicalFunctions.hpp>
+#include <Kokkos_MinMax.hpp>
+
+#include <initializer_list>
+#include <type_traits>
+
+namespace ArborX
+{
+namespace Details
+{
+
+// Lower and upper coordinates of a point or a box along a given axis.
+template <typename Geometry>
+KOKKOS_INLINE_FUNCTION constexpr auto axisMin(Geometry const &geometry, int d)
+{
+  static_assert(GeometryTraits::is_point_v<Geometry> ||
+                    GeometryTraits::is_box_v<Geometry>,
+                "Metrics are only implemented for points and boxes");
+  if constexpr (GeometryTraits::is_point_v<Geometry>)
+    return geometry[d];
+  else
+    return geometry.minCorner()[d];
+}
+
+template <typename Geometry>
+KOKKOS_INLINE_FUNCTION constexpr auto axisMax(Geometry const &geometry, int d)
+{
+  static_assert(GeometryTraits::is_point_v<Geometry> ||
+                    GeometryTraits::is_box_v<Geometry>,
+                "Metrics are only implemented for points and boxes");
+  if constexpr (GeometryTraits::is_point_v<Geometry>)
+    return geometry[d];
+  else
+    return geometry.maxCorner()[d];
+}
+
+// Gap between the projections of two geometries onto a given axis, zero if
+// the projections overlap. For axis-aligned boxes, all the metrics below are
+// monotone in the per-axis gaps, so combining them yields the exact minimum
+// distance between the two geometries (and thus a tight lower bound for any
+// primitive contained in a box).
+template <typename Geometry1, typename Geometry2>
+KOKKOS_INLINE_FUNCTION auto axisGap(Geometry1 const &geometry1,
+                                    Geometry2 const &geometry2, int d)
+{
+  using Coordinate = GeometryTraits::computation_type_t<decltype(
+      axisMin(geometry2, d) - axisMax(geometry1, d))>;
+  auto const lower = static_cast<Coordinate>(axisMin(geometry2, d)) -
+                     static_cast<Coordinate>(axisMax(geometry1, d));
+  auto const upper = static_cast<Coordinate>(axisMin(geometry1, d)) -
+                     static_cast<Coordinate>(axisMax(geometry2, d));
+  return Kokkos::max(Kokkos::max(lower, upper), static_cast<Coordinate>(0));
+}
+
+// Largest separation between the projections of two geometries onto a given
+// axis. For axis-aligned boxes, the per-axis spans are attained independently,
+// so combining them yields the exact maximum distance between the two
+// geometries (and thus a tight upper bound for any primitive in a box).
+template <typename Geometry1, typename Geometry2>
+KOKKOS_INLINE_FUNCTION auto axisSpan(Geometry1 const &geometry1,
+                                     Geometry2 const &geometry2, int d)
+{
+  using Coordinate = GeometryTraits::computation_type_t<decltype(
+      axisMax(geometry2, d) - axisMin(geometry1, d))>;
+  auto const lower = static_cast<Coordinate>(axisMax(geometry2, d)) -
+                     static_cast<Coordinate>(axisMin(geometry1, d));
+  auto const upper = static_cast<Coordinate>(axisMax(geometry1, d)) -
+                     static_cast<Coordinate>(axisMin(geometry2, d));
+  return Kokkos::max(lower, upper);
+}
+
+} // namespace Details
+
+namespace Experimental
+{
+
+// Default metric used by the nearest predicate. It forwards to the distance
+// function found through argument-dependent lookup, so that user-provided
+// distance overloads keep working.
+struct Euclidean
+{
+  template <typename Geometry1, typename Geometry2>
+  KOKKOS_FUNCTION auto distance(Geometry1 const &geometry1,
+                                Geometry2 const &geometry2) const
+  {
+    using Details::distance;
+    return distance(geometry1, geometry2);
+  }
+};
+
+// L1 metric
+struct Manhattan
+{
+  template <typename Geometry1, typename Geometry2>
+  KOKKOS_FUNCTION auto distance(Geometry1 const &geometry1,
+                                Geometry2 const &geometry2) const
+  {
+    constexpr int DIM = GeometryTraits::dimension_v<Geometry1>;
+    static_assert(GeometryTraits::dimension_v<Geometry2> == DIM);
+    auto r = Details::axisGap(geometry1, geometry2, 0);
+    for (int d = 1; d < DIM; ++d)
+      r += Details::axisGap(geometry1, geometry2, d);
+    return r;
+  }
+};
+
+// L-infinity metric
+struct Chebyshev
+{
+  template <typename Geometry1, typename Geometry2>
+  KOKKOS_FUNCTION auto distance(Geometry1 const &geometry1,
+                                Geometry2 const &geometry2) const
+  {
+    constexpr int DIM = GeometryTraits::dimension_v<Geometry1>;
+    static_assert(GeometryTraits::dimension_v<Geometry2> == DIM);
+    auto r = Details::axisGap(geometry1, geometry2, 0);
+    for (int d = 1; d < DIM; ++d)
+      r = Kokkos::max(r, Details::axisGap(geometry1, geometry2, d));
+    return r;
+  }
+};
+
+// L2 metric with a (positive) weight per axis:
+// d(x,y) = sqrt(sum_d w_d (x_d - y_d)^2)
+template <int DIM, typename Coordinate = float>
+struct WeightedEuclidean
+{
+  KOKKOS_DEFAULTED_FUNCTION
+  WeightedEuclidean() = default;
+
+  KOKKOS_FUNCTION
+  constexpr WeightedEuclidean(Coordinate const weights[DIM])
+  {
+    for (int d = 0; d < DIM; ++d)
+      _weights[d] = weights[d];
+  }
+
+  KOKKOS_FUNCTION
+  constexpr WeightedEuclidean(std::initializer_list<Coordinate> const weights)
+  {
+    KOKKOS_ASSERT(weights.size() == DIM);
+    int d = 0;
+    for (auto const &weight : weights)
+      _weights[d++] = weight;
+  }
+
+  template <typename Geometry1, typename Geometry2>
+  KOKKOS_FUNCTION auto distance(Geometry1 const &geometry1,
+                                Geometry2 const &geometry2) const
+  {
+    static_assert(GeometryTraits::dimension_v<Geometry1> == DIM);
+    static_assert(GeometryTraits::dimension_v<Geometry2> == DIM);
+    Coordinate distance_squared = 0;
+    for (int d = 0; d < DIM; ++d)
+    {
+      auto const gap = Details::axisGap(geometry1, geometry2, d);
+      distance_squared += _weights[d] * gap * gap;
+    }
+    return Kokkos::sqrt(distance_squared);
+  }
+
+  Coordinate _weights[DIM] = {};
+};
+
+template <typename T, std::size_t N>
+#if KOKKOS_VERSION >= 40400
+KOKKOS_DEDUCTION_GUIDE
+#else
+KOKKOS_FUNCTION
+#endif
+WeightedEuclidean(T const (&)[N]) -> WeightedEuclidean<N, T>;
+
+// Great-circle (geodesic) distance between points on a sphere of a given
+// radius. Points are expected to be unit vectors (see
+// geographicToCartesian()). For boxes, the Euclidean distance to the box is a
+// lower bound of the chord length to any point of the sphere within the box,
+// and the arc length is monotone in the chord length.
+template <typename Coordinate = float>
+struct GreatCircle
+{
+  KOKKOS_DEFAULTED_FUNCTION
+  GreatCircle() = default;
+
+  KOKKOS_FUNCTION
+  constexpr explicit GreatCircle(Coordinate radius)
+      : _radius(radius)
+  {}
+
+  template <typename Geometry1, typename Geometry2>
+  KOKKOS_FUNCTION auto distance(Geometry1 const &geometry1,
+                                Geometry2 const &geometry2) const
+  {
+    static_assert(GeometryTraits::dimension_v<Geometry1> == 3);
+    static_assert(GeometryTraits::dimension_v<Geometry2> == 3);
+    auto const half_chord = Details::distance(geometry1, geometry2) / 2;
+    using T = std::decay_t<decltype(half_chord)>;
+    return 2 * _radius * Kokkos::asin(Kokkos::min(half_chord, T(1)));
+  }
+
+  Coordinate _radius = 1;
+};
+
+// Mahalanobis metric defined by a symmetric positive-definite matrix M:
+// d(x,y) = sqrt((x-y)^T M (x-y))
+// The metric of an ellipsoid, for which the ellipsoid is the unit ball, is
+// obtained with Mahalanobis{ellipsoid.rmt()}.
+//
+// The distance to a box is bounded from below using convexity: for any point
+// y0 of the box, q(y) >= q(y0) + grad q(y0).(y - y0), and the right-hand side
+// is minimized over the box corner by corner. y0 is obtained by a few sweeps
+// of projected coordinate descent, starting from the Euclidean projection.
+// The bound is exact for points and degenerate boxes, and converges to the
+// exact distance with the number of sweeps otherwise.
+template <int DIM, typename Coordinate = float>
+struct Mahalanobis
+{
+  KOKKOS_DEFAULTED_FUNCTION
+  Mahalanobis() = default;
+
+  KOKKOS_FUNCTION
+  constexpr Mahalanobis(Coordinate const matrix[DIM][DIM])
+  {
+    for (int i = 0; i < DIM; ++i)
+      for (int j = 0; j < DIM; ++j)
+        _matrix[i][j] = matrix[i][j];
+  }
+
+  KOKKOS_FUNCTION
+  constexpr Mahalanobis(
+      std::initializer_list<std::initializer_list<Coordinate>> const matrix)
+  {
+    KOKKOS_ASSERT(matrix.size() == DIM);
+    int i = 0;
+    for (auto const &row : matrix)
+    {
+      KOKKOS_ASSERT(row.size() == DIM);
+      int j = 0;
+      for (auto const &value : row)
+        _matrix[i][j++] = value;
+      ++i;
+    }
+  }
+
+  template <typename Geometry1, typename Geometry2>
+  KOKKOS_FUNCTION auto distance(Geometry1 const &geometry1,
+                                Geometry2 const &geometry2) const
+  {
+    static_assert(GeometryTraits::dimension_v<Geometry1> == DIM);
+    static_assert(GeometryTraits::dimension_v<Geometry2> == DIM);
+    if constexpr (GeometryTraits::is_box_v<Geometry1>)
+    {
+      static_assert(GeometryTraits::is_point_v<Geometry2>,
+                    "Mahalanobis distance is only implemented between a "
+                    "point and a point or a box");
+      return distance(geometry2, geometry1);
+    }
+    else
+    {
+      static_assert(GeometryTraits::is_point_v<Geometry1>,
+                    "Mahalanobis distance is only implemented between a "
+                    "point and a point or a box");
+      Coordinate x[DIM];
+      Coordinate y[DIM];
+      for (int d = 0; d < DIM; ++d)
+      {
+        x[d] = geometry1[d];
+        y[d] = Kokkos::clamp<Coordinate>(x[d], Details::axisMin(geometry2, d),
+                                         Details::axisMax(geometry2, d));
+      }
+      if constexpr (GeometryTraits::is_point_v<Geometry2>)
+        return Kokkos::sqrt(quadraticForm(x, y));
+      else
+        return Kokkos::sqrt(boxLowerBound(x, y, geometry2));
+    }
+  }
+
+  Coordinate _matrix[DIM][DIM] = {};
+
+private:
+  // (y-x)^T M (y-x)
+  KOKKOS_FUNCTION Coordinate quadraticForm(Coordinate const x[DIM],
+                                           Coordinate const y[DIM]) const
+  {
+    Coordinate r = 0;
+    for (int i = 0; i < DIM; ++i)
+      for (int j = 0; j < DIM; ++j)
+        r += (y[i] - x[i]) * _matrix[i][j] * (y[j] - x[j]);
+    return r;
+  }
+
+  template <typename Box>
+  KOKKOS_FUNCTION Coordinate boxLowerBound(Coordinate const x[DIM],
+                                           Coordinate y[DIM],
+                                           Box const &box) const
+  {
+    constexpr int num_sweeps = 2;
+    for (int sweep = 0; sweep < num_sweeps; ++sweep)
+      for (int i = 0; i < DIM; ++i)
+      {
+        Coordinate gradient = 0;
+        for (int j = 0; j < DIM; ++j)
+          gradient += _matrix[i][j] * (y[j] - x[j]);
+        y[i] = Kokkos::clamp<Coordinate>(y[i] - gradient / _matrix[i][i],
+                                         box.minCorner()[i],
+                                         box.maxCorner()[i]);
+      }
+
+    // Linear lower bound at y
+    Coordinate r = quadraticForm(x, y);
+    for (int i = 0; i < DIM; ++i)
+    {
+      Coordinate half_gradient = 0;
+      for (int j = 0; j < DIM; ++j)
+        half_gradient += _matrix[i][j] * (y[j] - x[j]);
+      auto const target =
+          (half_gradient > 0 ? box.minCorner()[i] : box.maxCorner()[i]);
+      r += 2 * half_gradient * (target - y[i]);
+    }
+    return Kokkos::max(r, Coordinate(0));
+  }
+};
+
+template <typename T, std::size_t N>
+#if KOKKOS_VERSION >= 40400
+KOKKOS_DEDUCTION_GUIDE
+#else
+KOKKOS_FUNCTION
+#endif
+Mahalanobis(T const (&)[N][N]) -> Mahalanobis<N, T>;
+
+// Reversed L2 order, used by the farthest predicate. The "distance" is the
+// opposite of the largest distance between the two geometries, so that the
+// nearest values for this metric are the farthest ones. For a box, it bounds
+// from below the value of every primitive inside, and the nearest traversal
+// prunes the subtrees whose farthest point is closer than the k-th best.
+struct Farthest
+{
+  template <typename Geometry1, typename Geometry2>
+  KOKKOS_FUNCTION auto distance(Geometry1 const &geometry1,
+                                Geometry2 const &geometry2) const
+  {
+    constexpr int DIM = GeometryTraits::dimension_v<Geometry1>;
+    static_assert(GeometryTraits::dimension_v<Geometry2> == DIM);
+    auto const span = Details::axisSpan(geometry1, geometry2, 0);
+    auto r = span * span;
+    for (int d = 1; d < DIM; ++d)
+    {
+      auto const span_d = Details::axisSpan(geometry1, geometry2, d);
+      r += span_d * span_d;
+    }
+    return -Kokkos::sqrt(r);
+  }
+};
+
+} // namespace Experimental
+
+} // namespace ArborX
+
+#endif
@@ -0,0 +1,117 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+#ifndef ARBORX_SPATIO_TEMPORAL_HPP
+#define ARBORX_SPATIO_TEMPORAL_HPP
+
+#include <ArborX_Box.hpp>
+#include <ArborX_GeometryTraits.hpp>
+#include <ArborX_Point.hpp>
+
+#include <Kokkos_Macros.hpp>
+
+namespace ArborX::Experimental
+{
+
+// Spatial geometry extruded over a time interval [t_begin, t_end].
+//
+// Spatio-temporal data is indexed with (DIM+1)-dimensional points and boxes
+// whose last coordinate is the time, e.g. Point<4> samples or Box<4> bounds of
+// the trajectory segments of 3D objects. A spatio-temporal geometry then
+// selects the data within the spatial geometry at some time in the interval.
+template <typename Geometry>
+struct SpatioTemporal
+{
+  using Coordinate = GeometryTraits::coordinate_type_t<Geometry>;
+
+  KOKKOS_DEFAULTED_FUNCTION
+  SpatioTemporal() = default;
+
+  KOKKOS_FUNCTION
+  constexpr SpatioTemporal(Geometry const &geometry, Coordinate t_begin,
+                           Coordinate t_end)
+      : _geometry(geometry)
+      , _t_begin(t_begin)
+      , _t_end(t_end)
+  {}
+
+  KOKKOS_FUNCTION
+  constexpr auto const &geometry() const { return _geometry; }
+
+  KOKKOS_FUNCTION
+  constexpr auto timeBegin() const { return _t_begin; }
+
+  KOKKOS_FUNCTION
+  constexpr auto timeEnd() const { return _t_end; }
+
+  Geometry _geometry = {};
+  Coordinate _t_begin = 0;
+  Coordinate _t_end = 0;
+};
+
+template <typename Geometry, typename T>
+#if KOKKOS_VERSION >= 40400
+KOKKOS_DEDUCTION_GUIDE
+#else
+KOKKOS_FUNCTION
+#endif
+SpatioTemporal(Geometry, T, T) -> SpatioTemporal<Geometry>;
+
+} // namespace ArborX::Experimental
+
+namespace ArborX::Details
+{
+
+// Spatial part (all but the last coordinate) of a spatio-temporal point
+template <typename Point, std::enable_if_t<GeometryTraits::is_point_v<Point>>
+                              * = nullptr>
+KOKKOS_FUNCTION constexpr auto spatialPart(Point const &point)
+{
+  constexpr int DIM = GeometryTraits::dimension_v<Point> - 1;
+  static_assert(DIM > 0);
+  ::ArborX::Point<DIM, GeometryTraits::coordinate_type_t<Point>> spatial;
+  for (int d = 0; d < DIM; ++d)
+    spatial[d] = point[d];
+  return spatial;
+}
+
+// Spatial part (all but the last dimension) of a spatio-temporal box
+template <typename Box,
+          std::enable_if_t<GeometryTraits::is_box_v<Box>> * = nullptr>
+KOKKOS_FUNCTION constexpr auto spatialPart(Box const &box)
+{
+  constexpr int DIM = GeometryTraits::dimension_v<Box> - 1;
+  static_assert(DIM > 0);
+  return ::ArborX::Box<DIM, GeometryTraits::coordinate_type_t<Box>>{
+      spatialPart(box.minCorner()), spatialPart(box.maxCorner())};
+}
+
+} // namespace ArborX::Details
+
+template <typename Geometry>
+struct ArborX::GeometryTraits::dimension<
+    ArborX::Experimental::SpatioTemporal<Geometry>>
+{
+  static constexpr int value = dimension_v<Geometry> + 1;
+};
+template <typename Geometry>
+struct ArborX::GeometryTraits::tag<
+    ArborX::Experimental::SpatioTemporal<Geometry>>
+{
+  using type = SpatioTemporalTag;
+};
+template <typename Geometry>
+struct ArborX::GeometryTraits::coordinate_type<
+    ArborX::Experimental::SpatioTemporal<Geometry>>
+{
+  using type = coordinate_type_t<Geometry>;
+};
+
+#endif
@@ -0,0 +1,115 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+#ifndef ARBORX_SPHERICAL_CAP_HPP
+#define ARBORX_SPHERICAL_CAP_HPP
+
+#include <ArborX_GeometryTraits.hpp>
+#include <ArborX_Point.hpp>
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_MathematicalConstants.hpp>
+#include <Kokkos_MathematicalFunctions.hpp>
+#include <Kokkos_MinMax.hpp>
+
+namespace ArborX::Experimental
+{
+
+// Convert geographic coordinates (latitude and longitude, in degrees) to a
+// point on the unit sphere. Geodesic data is indexed through these unit
+// vectors, which avoids the distortion near the poles and the discontinuity
+// at the antimeridian of the (latitude, longitude) parametrization.
+template <typename Coordinate>
+KOKKOS_FUNCTION Point<3, Coordinate>
+geographicToCartesian(Coordinate latitude, Coordinate longitude)
+{
+  constexpr Coordinate degrees_to_radians =
+      Kokkos::numbers::pi_v<Coordinate> / 180;
+  auto const phi = latitude * degrees_to_radians;
+  auto const lambda = longitude * degrees_to_radians;
+  auto const cos_phi = Kokkos::cos(phi);
+  return {cos_phi * Kokkos::cos(lambda), cos_phi * Kokkos::sin(lambda),
+          Kokkos::sin(phi)};
+}
+
+// Set of the points on the unit sphere within a given great-circle distance
+// (angle, in radians) of the center. The center must be a unit vector.
+template <class Coordinate = float>
+struct SphericalCap
+{
+  KOKKOS_DEFAULTED_FUNCTION
+  SphericalCap() = default;
+
+  KOKKOS_FUNCTION
+  constexpr SphericalCap(Point<3, Coordinate> const &center, Coordinate angle)
+      : _center(center)
+      , _angle(angle)
+  {}
+
+  KOKKOS_FUNCTION
+  constexpr auto &center() { return _center; }
+
+  KOKKOS_FUNCTION
+  constexpr auto const &center() const { return _center; }
+
+  KOKKOS_FUNCTION
+  constexpr auto angle() const { return _angle; }
+
+  // Radius of the Euclidean ball whose intersection with the unit sphere is
+  // the cap
+  KOKKOS_FUNCTION
+  auto chordLength() const
+  {
+    constexpr auto pi = Kokkos::numbers::pi_v<Coordinate>;
+    return 2 * Kokkos::sin(Kokkos::min(_angle, pi) / 2);
+  }
+
+  Point<3, Coordinate> _center = {};
+  Coordinate _angle = 0;
+};
+
+template <typename T>
+#if KOKKOS_VERSION >= 40400
+KOKKOS_DEDUCTION_GUIDE
+#else
+KOKKOS_FUNCTION
+#endif
+SphericalCap(T const (&)[3], T) -> SphericalCap<T>;
+
+template <typename T>
+#if KOKKOS_VERSION >= 40400
+KOKKOS_DEDUCTION_GUIDE
+#else
+KOKKOS_FUNCTION
+#endif
+SphericalCap(Point<3, T> const &, T) -> SphericalCap<T>;
+
+} // namespace ArborX::Experimental
+
+template <class Coordinate>
+struct ArborX::GeometryTraits::dimension<
+    ArborX::Experimental::SphericalCap<Coordinate>>
+{
+  static constexpr int value = 3;
+};
+template <class Coordinate>
+struct ArborX::GeometryTraits::tag<
+    ArborX::Experimental::SphericalCap<Coordinate>>
+{
+  using type = SphericalCapTag;
+};
+template <class Coordinate>
+struct ArborX::GeometryTraits::coordinate_type<
+    ArborX::Experimental::SphericalCap<Coordinate>>
+{
+  using type = Coordinate;
+};
+
+#endif
@@ -133,6 +133,30 @@ struct centroid<EllipsoidTag, Ellipsoid>
   }
 };
 
+template <typename SphericalCap>
+struct centroid<SphericalCapTag, SphericalCap>
+{
+  KOKKOS_FUNCTION static auto apply(SphericalCap const &cap)
+  {
+    return cap.center();
+  }
+};
+
+template <typename SpatioTemporal>
+struct centroid<SpatioTemporalTag, SpatioTemporal>
+{
+  KOKKOS_FUNCTION static auto apply(SpatioTemporal const &region)
+  {
+    constexpr int DIM = dimension_v<SpatioTemporal> - 1;
+    auto const spatial_centroid = returnCentroid(region.geometry());
+    Point<DIM + 1, coordinate_type_t<SpatioTemporal>> point;
+    for (int d = 0; d < DIM; ++d)
+      point[d] = spatial_centroid[d];
+    point[DIM] = (region.timeBegin() + region.timeEnd()) / 2;
+    return point;
+  }
+};
+
 } // namespace Dispatch
 
 } // namespace ArborX::Details
@@ -0,0 +1,148 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+#ifndef ARBORX_DETAILS_GEOMETRY_CONTAINS_HPP
+#define ARBORX_DETAILS_GEOMETRY_CONTAINS_HPP
+
+#include "ArborX_Distance.hpp"
+#include "ArborX_Intersects.hpp"
+#include <ArborX_GeometryTraits.hpp>
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_MathematicalFunctions.hpp>
+#include <Kokkos_MinMax.hpp>
+
+namespace ArborX::Details
+{
+namespace Dispatch
+{
+template <typename Tag1, typename Tag2, typename Geometry1, typename Geometry2>
+struct contains;
+}
+
+// Check whether the second geometry lies entirely inside the first one
+// (boundaries included)
+template <typename Geometry1, typename Geometry2>
+KOKKOS_INLINE_FUNCTION constexpr bool contains(Geometry1 const &geometry1,
+                                               Geometry2 const &geometry2)
+{
+  static_assert(GeometryTraits::dimension_v<Geometry1> ==
+                GeometryTraits::dimension_v<Geometry2>);
+  return Dispatch::contains<GeometryTraits::tag_t<Geometry1>,
+                            GeometryTraits::tag_t<Geometry2>, Geometry1,
+                            Geometry2>::apply(geometry1, geometry2);
+}
+
+namespace Dispatch
+{
+
+using namespace GeometryTraits;
+
+// check if a box contains a point
+template <typename Box, typename Point>
+struct contains<BoxTag, PointTag, Box, Point>
+{
+  KOKKOS_FUNCTION static constexpr bool apply(Box const &box,
+                                              Point const &point)
+  {
+    return Details::intersects(point, box);
+  }
+};
+
+// check if a box contains another box
+template <typename Box1, typename Box2>
+struct contains<BoxTag, BoxTag, Box1, Box2>
+{
+  KOKKOS_FUNCTION static constexpr bool apply(Box1 const &box,
+                                              Box2 const &other)
+  {
+    constexpr int DIM = dimension_v<Box1>;
+    for (int d = 0; d < DIM; ++d)
+      if (other.minCorner()[d] < box.minCorner()[d] ||
+          other.maxCorner()[d] > box.maxCorner()[d])
+        return false;
+    return true;
+  }
+};
+
+// check if a box contains a sphere
+template <typename Box, typename Sphere>
+struct contains<BoxTag, SphereTag, Box, Sphere>
+{
+  KOKKOS_FUNCTION static constexpr bool apply(Box const &box,
+                                              Sphere const &sphere)
+  {
+    constexpr int DIM = dimension_v<Box>;
+    auto const &center = sphere.centroid();
+    auto const r = sphere.radius();
+    for (int d = 0; d < DIM; ++d)
+      if (center[d] - r < box.minCorner()[d] ||
+          center[d] + r > box.maxCorner()[d])
+        return false;
+    return true;
+  }
+};
+
+// check if a sphere contains a point
+template <typename Sphere, typename Point>
+struct contains<SphereTag, PointTag, Sphere, Point>
+{
+  KOKKOS_FUNCTION static constexpr bool apply(Sphere const &sphere,
+                                              Point const &point)
+  {
+    return Details::intersects(sphere, point);
+  }
+};
+
+// check if a sphere contains a box, i.e. the farthest corner of the box from
+// the center of the sphere is within the radius
+template <typename Sphere, typename Box>
+struct contains<SphereTag, BoxTag, Sphere, Box>
+{
+  KOKKOS_FUNCTION static auto apply(Sphere const &sphere, Box const &box)
+  {
+    constexpr int DIM = dimension_v<Box>;
+    using Coordinate = GeometryTraits::computation_type_t<
+        GeometryTraits::coordinate_type_t<Box>>;
+    auto const &center = sphere.centroid();
+    Coordinate distance_squared = 0;
+    for (int d = 0; d < DIM; ++d)
+    {
+      auto const c = static_cast<Coordinate>(center[d]);
+      auto const lo = static_cast<Coordinate>(box.minCorner()[d]);
+      auto const hi = static_cast<Coordinate>(box.maxCorner()[d]);
+      auto const tmp = Kokkos::max(Kokkos::abs(c - lo), Kokkos::abs(hi - c));
+      distance_squared += tmp * tmp;
+    }
+    auto const r = static_cast<Coordinate>(sphere.radius());
+    return distance_squared <= r * r;
+  }
+};
+
+// check if a sphere contains another sphere
+template <typename Sphere1, typename Sphere2>
+struct contains<SphereTag, SphereTag, Sphere1, Sphere2>
+{
+  KOKKOS_FUNCTION static auto apply(Sphere1 const &sphere,
+                                    Sphere2 const &other)
+  {
+    auto const distance =
+        Details::distance(sphere.centroid(), other.centroid());
+    using Coordinate = decltype(distance);
+    return distance + static_cast<Coordinate>(other.radius()) <=
+           static_cast<Coordinate>(sphere.radius());
+  }
+};
+
+} // namespace Dispatch
+
+} // namespace ArborX::Details
+
+#endif
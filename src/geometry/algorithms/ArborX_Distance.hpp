@@ -19,6 +19,8 @@
 #include <Kokkos_MathematicalFunctions.hpp>
 #include <Kokkos_MinMax.hpp>
 
+#include <type_traits>
+
 namespace ArborX::Details
 {
 namespace Dispatch
@@ -53,11 +55,11 @@ struct distance<PointTag, PointTag, Point1, Point2>
     constexpr int DIM = dimension_v<Point1>;
     // Points may have different coordinate types. Try using implicit
     // conversion to get the best one.
-    using Coordinate = decltype(b[0] - a[0]);
+    using Coordinate = computation_type_t<decltype(b[0] - a[0])>;
     Coordinate distance_squared = 0;
     for (int d = 0; d < DIM; ++d)
     {
-      auto tmp = b[d] - a[d];
+      auto tmp = static_cast<Coordinate>(b[d]) - static_cast<Coordinate>(a[d]);
       distance_squared += tmp * tmp;
     }
     return Kokkos::sqrt(distance_squared);
@@ -101,8 +103,10 @@ struct distance<PointTag, SphereTag, Point, Sphere>
   KOKKOS_FUNCTION static auto apply(Point const &point, Sphere const &sphere)
   {
     using Kokkos::max;
-    return max(Details::distance(point, sphere.centroid()) - sphere.radius(),
-               0.f);
+    auto const distance_point_sphere =
+        Details::distance(point, sphere.centroid()) - sphere.radius();
+    using Coordinate = std::decay_t<decltype(distance_point_sphere)>;
+    return max(distance_point_sphere, static_cast<Coordinate>(0));
   }
 };
 
@@ -124,8 +128,11 @@ struct distance<PointTag, TriangleTag, Point, Triangle>
       r[d] = u * a[d] + v * b[d] + w * c[d];
     return r;
   }
+  // The zone of the closest point is reported for callers that need to know
+  // whether it lies on a vertex, an edge or inside the triangle
   KOKKOS_FUNCTION static auto closest_point(Point const &p, Point const &a,
-                                            Point const &b, Point const &c)
+                                            Point const &b, Point const &c,
+                                            int &zone)
   {
     /* Zones
            \ 2/
@@ -146,23 +153,33 @@ struct distance<PointTag, TriangleTag, Point, Triangle>
     auto const d1 = ab.dot(ap);
     auto const d2 = ac.dot(ap);
     if (d1 <= 0 && d2 <= 0) // zone 1
+    {
+      zone = 1;
       return a;
+    }
 
     auto const bp = p - b;
     auto const d3 = ab.dot(bp);
     auto const d4 = ac.dot(bp);
     if (d3 >= 0 && d4 <= d3) // zone 2
+    {
+      zone = 2;
       return b;
+    }
 
     auto const cp = p - c;
     auto const d5 = ab.dot(cp);
     auto const d6 = ac.dot(cp);
     if (d6 >= 0 && d5 <= d6) // zone 3
+    {
+      zone = 3;
       return c;
+    }
 
     auto const vc = d1 * d4 - d3 * d2;
     if (vc <= 0 && d1 >= 0 && d3 <= 0) // zone 5
     {
+      zone = 5;
       auto const v = d1 / (d1 - d3);
       return combine(a, b, c, 1 - v, v, 0);
     }
@@ -170,6 +187,7 @@ struct distance<PointTag, TriangleTag, Point, Triangle>
     auto const vb = d5 * d2 - d1 * d6;
     if (vb <= 0 && d2 >= 0 && d6 <= 0) // zone 4
     {
+      zone = 4;
       auto const v = d2 / (d2 - d6);
       return combine(a, b, c, 1 - v, 0, v);
     }
@@ -177,16 +195,24 @@ struct distance<PointTag, TriangleTag, Point, Triangle>
     auto const va = d3 * d6 - d5 * d4;
     if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0) // zone 6
     {
+      zone = 6;
       auto const v = (d4 - d3) / ((d4 - d3) + (d5 - d6));
       return combine(a, b, c, 0, 1 - v, v);
     }
 
     // zone 0
+    zone = 0;
     auto const denom = 1 / (va + vb + vc);
     auto const v = vb * denom;
     auto const w = vc * denom;
     return combine(a, b, c, 1 - v - w, v, w);
   }
+  KOKKOS_FUNCTION static auto closest_point(Point const &p, Point const &a,
+                                            Point const &b, Point const &c)
+  {
+    int zone;
+    return closest_point(p, a, b, c, zone);
+  }
 
   KOKKOS_FUNCTION static auto apply(Point const &p, Triangle const &triangle)
   {
@@ -207,14 +233,15 @@ struct distance<BoxTag, BoxTag, Box1, Box2>
     constexpr int DIM = dimension_v<Box1>;
     // Boxes may have different coordinate types. Try using implicit
     // conversion to get the best one.
-    using Coordinate = decltype(box_b.minCorner()[0] - box_a.minCorner()[0]);
+    using Coordinate = computation_type_t<decltype(box_b.minCorner()[0] -
+                                                   box_a.minCorner()[0])>;
     Coordinate distance_squared = 0;
     for (int d = 0; d < DIM; ++d)
     {
-      auto const a_min = box_a.minCorner()[d];
-      auto const a_max = box_a.maxCorner()[d];
-      auto const b_min = box_b.minCorner()[d];
-      auto const b_max = box_b.maxCorner()[d];
+      auto const a_min = static_cast<Coordinate>(box_a.minCorner()[d]);
+      auto const a_max = static_cast<Coordinate>(box_a.maxCorner()[d]);
+      auto const b_min = static_cast<Coordinate>(box_b.minCorner()[d]);
+      auto const b_max = static_cast<Coordinate>(box_b.maxCorner()[d]);
       if (a_min > b_max)
       {
         auto const delta = a_min - b_max;
@@ -243,7 +270,9 @@ struct distance<SphereTag, BoxTag, Sphere, Box>
     using Kokkos::max;
 
     auto distance_center_box = Details::distance(sphere.centroid(), box);
-    return max(distance_center_box - sphere.radius(), 0.f);
+    auto const distance_sphere_box = distance_center_box - sphere.radius();
+    using Coordinate = std::decay_t<decltype(distance_sphere_box)>;
+    return max(distance_sphere_box, static_cast<Coordinate>(0));
   }
 };
 
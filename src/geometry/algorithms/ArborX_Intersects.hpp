@@ -15,11 +15,13 @@
 #include "ArborX_Expand.hpp"
 #include <ArborX_GeometryTraits.hpp>
 #include <ArborX_Segment.hpp>
+#include <ArborX_SpatioTemporal.hpp>
 #include <misc/ArborX_Vector.hpp>
 
 #include <Kokkos_Array.hpp>
 #include <Kokkos_Clamp.hpp>
 #include <Kokkos_MathematicalFunctions.hpp>
+#include <Kokkos_MinMax.hpp>
 
 namespace ArborX::Details
 {
@@ -92,7 +94,8 @@ struct intersects<SphereTag, BoxTag, Sphere, Box>
   KOKKOS_FUNCTION static constexpr bool apply(Sphere const &sphere,
                                               Box const &box)
   {
-    return Details::distance(sphere.centroid(), box) <= sphere.radius();
+    auto const distance = Details::distance(sphere.centroid(), box);
+    return distance <= static_cast<decltype(distance)>(sphere.radius());
   }
 };
 
@@ -103,7 +106,8 @@ struct intersects<SphereTag, PointTag, Sphere, Point>
   KOKKOS_FUNCTION static constexpr bool apply(Sphere const &sphere,
                                               Point const &point)
   {
-    return Details::distance(sphere.centroid(), point) <= sphere.radius();
+    auto const distance = Details::distance(sphere.centroid(), point);
+    return distance <= static_cast<decltype(distance)>(sphere.radius());
   }
 };
 
@@ -632,6 +636,99 @@ struct intersects<BoxTag, EllipsoidTag, Box, Ellipsoid>
   }
 };
 
+// check if a spherical cap intersects with a point on the unit sphere
+template <typename SphericalCap, typename Point>
+struct intersects<SphericalCapTag, PointTag, SphericalCap, Point>
+{
+  KOKKOS_FUNCTION static constexpr bool apply(SphericalCap const &cap,
+                                              Point const &point)
+  {
+    return Details::distance(cap.center(), point) <= cap.chordLength();
+  }
+};
+
+template <typename Point, typename SphericalCap>
+struct intersects<PointTag, SphericalCapTag, Point, SphericalCap>
+{
+  KOKKOS_FUNCTION static constexpr bool apply(Point const &point,
+                                              SphericalCap const &cap)
+  {
+    return Details::intersects(cap, point);
+  }
+};
+
+// check if a spherical cap may intersect with an axis-aligned bounding box
+// of points on the unit sphere. The box must reach the unit sphere, and the
+// ball cutting the cap out of the sphere must intersect the box. This never
+// rejects a box containing a point of the cap.
+template <typename SphericalCap, typename Box>
+struct intersects<SphericalCapTag, BoxTag, SphericalCap, Box>
+{
+  KOKKOS_FUNCTION static constexpr bool apply(SphericalCap const &cap,
+                                              Box const &box)
+  {
+    using Coordinate = coordinate_type_t<Box>;
+
+    // Squared distances from the origin to the closest and the farthest
+    // points of the box
+    Coordinate min_norm_squared = 0;
+    Coordinate max_norm_squared = 0;
+    for (int d = 0; d < 3; ++d)
+    {
+      auto const lo = box.minCorner()[d];
+      auto const hi = box.maxCorner()[d];
+      auto const closest = (lo > 0 ? lo : (hi < 0 ? hi : 0));
+      auto const farthest = Kokkos::max(Kokkos::abs(lo), Kokkos::abs(hi));
+      min_norm_squared += closest * closest;
+      max_norm_squared += farthest * farthest;
+    }
+    // Allow for the rounding in unit vectors
+    constexpr Coordinate eps = 1e-5;
+    if (min_norm_squared > 1 + eps || max_norm_squared < 1 - eps)
+      return false;
+
+    return Details::distance(cap.center(), box) <= cap.chordLength();
+  }
+};
+
+template <typename Box, typename SphericalCap>
+struct intersects<BoxTag, SphericalCapTag, Box, SphericalCap>
+{
+  KOKKOS_FUNCTION static constexpr bool apply(Box const &box,
+                                              SphericalCap const &cap)
+  {
+    return Details::intersects(cap, box);
+  }
+};
+
+// check if a spatio-temporal geometry intersects with a point or a box whose
+// last coordinate is the time
+template <typename SpatioTemporal, typename Geometry>
+struct intersects<SpatioTemporalTag, PointTag, SpatioTemporal, Geometry>
+{
+  KOKKOS_FUNCTION static constexpr bool apply(SpatioTemporal const &region,
+                                              Geometry const &point)
+  {
+    constexpr int DIM = dimension_v<Geometry> - 1;
+    return point[DIM] >= region.timeBegin() &&
+           point[DIM] <= region.timeEnd() &&
+           Details::intersects(region.geometry(), spatialPart(point));
+  }
+};
+
+template <typename SpatioTemporal, typename Box>
+struct intersects<SpatioTemporalTag, BoxTag, SpatioTemporal, Box>
+{
+  KOKKOS_FUNCTION static constexpr bool apply(SpatioTemporal const &region,
+                                              Box const &box)
+  {
+    constexpr int DIM = dimension_v<Box> - 1;
+    return box.maxCorner()[DIM] >= region.timeBegin() &&
+           box.minCorner()[DIM] <= region.timeEnd() &&
+           Details::intersects(region.geometry(), spatialPart(box));
+  }
+};
+
 } // namespace Dispatch
 
 } // namespace ArborX::Details
@@ -20,20 +20,27 @@ namespace ArborX::Details
 {
 // transformation that maps the unit cube into a new axis-aligned box
 // NOTE safe to perform in-place
-template <typename Point, typename Box,
-          std::enable_if_t<GeometryTraits::is_point_v<Point> &&
+template <typename InPoint, typename OutPoint, typename Box,
+          std::enable_if_t<GeometryTraits::is_point_v<InPoint> &&
+                           GeometryTraits::is_point_v<OutPoint> &&
                            GeometryTraits::is_box_v<Box>> * = nullptr>
-KOKKOS_FUNCTION void translateAndScale(Point const &in, Point &out,
+KOKKOS_FUNCTION void translateAndScale(InPoint const &in, OutPoint &out,
                                        Box const &ref)
 {
-  static_assert(GeometryTraits::dimension_v<Point> ==
+  static_assert(GeometryTraits::dimension_v<InPoint> ==
                 GeometryTraits::dimension_v<Box>);
-  constexpr int DIM = GeometryTraits::dimension_v<Point>;
+  static_assert(GeometryTraits::dimension_v<OutPoint> ==
+                GeometryTraits::dimension_v<Box>);
+  constexpr int DIM = GeometryTraits::dimension_v<InPoint>;
+  using Coordinate = GeometryTraits::computation_type_t<
+      GeometryTraits::coordinate_type_t<Box>>;
+  using OutCoordinate = GeometryTraits::coordinate_type_t<OutPoint>;
   for (int d = 0; d < DIM; ++d)
   {
-    auto const a = ref.minCorner()[d];
-    auto const b = ref.maxCorner()[d];
-    out[d] = (a != b ? (in[d] - a) / (b - a) : 0);
+    auto const a = static_cast<Coordinate>(ref.minCorner()[d]);
+    auto const b = static_cast<Coordinate>(ref.maxCorner()[d]);
+    out[d] = static_cast<OutCoordinate>(
+        a != b ? (static_cast<Coordinate>(in[d]) - a) / (b - a) : 0);
   }
 }
 } // namespace ArborX::Details
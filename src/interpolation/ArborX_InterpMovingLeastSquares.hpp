@@ -21,6 +21,7 @@
 #include <detail/ArborX_InterpDetailsMovingLeastSquaresCoefficients.hpp>
 #include <detail/ArborX_InterpDetailsPolynomialBasis.hpp>
 #include <detail/ArborX_PredicateHelpers.hpp>
+#include <kokkos_ext/ArborX_KokkosExtViewHelpers.hpp>
 
 #include <Kokkos_Core.hpp>
 #include <Kokkos_Profiling_ScopedRegion.hpp>
@@ -181,6 +182,14 @@ public:
         });
   }
 
+  // Number of bytes allocated for the coefficients and the indices of the
+  // neighbors of the targets
+  std::size_t memory_footprint() const noexcept
+  {
+    return Details::KokkosExt::memorySpan(_coeffs) +
+           Details::KokkosExt::memorySpan(_indices);
+  }
+
 private:
   template <typename ExecutionSpace, typename SourceAccess,
             typename TargetAccess>
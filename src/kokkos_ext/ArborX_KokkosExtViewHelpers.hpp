@@ -16,6 +16,8 @@
 
 #include <Kokkos_Core.hpp>
 
+#include <cstddef>
+
 namespace ArborX::Details::KokkosExt
 {
 
@@ -99,6 +101,14 @@ cloneWithoutInitializingNorCopying(ExecutionSpace const &space, View const &v)
                                v);
 }
 
+// Number of bytes allocated for the view, including the padding if any
+template <class View>
+std::size_t memorySpan(View const &v)
+{
+  static_assert(Kokkos::is_view<View>::value);
+  return v.span() * sizeof(typename View::value_type);
+}
+
 } // namespace ArborX::Details::KokkosExt
 
 #endif
@@ -23,6 +23,7 @@
 #include <detail/ArborX_PairValueIndex.hpp>
 #include <detail/ArborX_PredicateHelpers.hpp>
 #include <kokkos_ext/ArborX_KokkosExtAccessibilityTraits.hpp>
+#include <kokkos_ext/ArborX_KokkosExtViewHelpers.hpp>
 
 #include <Kokkos_Core.hpp>
 #include <Kokkos_Profiling_ScopedRegion.hpp>
@@ -61,6 +62,12 @@ public:
   KOKKOS_FUNCTION
   bounding_volume_type bounds() const noexcept { return _bounds; }
 
+  // Number of bytes allocated for the values
+  std::size_t memory_footprint() const noexcept
+  {
+    return Details::KokkosExt::memorySpan(_values);
+  }
+
   template <typename ExecutionSpace, typename Predicates, typename Callback,
             typename Ignore = int>
   void query(ExecutionSpace const &space, Predicates const &predicates,
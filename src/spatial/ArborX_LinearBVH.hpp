@@ -14,11 +14,13 @@
 
 #include <ArborX_Box.hpp>
 #include <ArborX_CrsGraphWrapper.hpp>
+#include <ArborX_Point.hpp>
 #include <detail/ArborX_AccessTraits.hpp>
 #include <detail/ArborX_AttachIndices.hpp>
 #include <detail/ArborX_Callbacks.hpp>
 #include <detail/ArborX_CrsGraphWrapperImpl.hpp>
 #include <detail/ArborX_IndexableGetter.hpp>
+#include <detail/ArborX_MemoryEstimates.hpp>
 #include <detail/ArborX_Node.hpp>
 #include <detail/ArborX_PairValueIndex.hpp>
 #include <detail/ArborX_PermutedData.hpp>
@@ -28,6 +30,7 @@
 #include <detail/ArborX_TreeConstruction.hpp>
 #include <detail/ArborX_TreeTraversal.hpp>
 #include <kokkos_ext/ArborX_KokkosExtAccessibilityTraits.hpp>
+#include <kokkos_ext/ArborX_KokkosExtViewHelpers.hpp>
 #include <misc/ArborX_SortUtils.hpp>
 
 #include <Kokkos_Core.hpp>
@@ -81,6 +84,49 @@ public:
   KOKKOS_FUNCTION
   bounding_volume_type bounds() const noexcept { return _bounds; }
 
+  // Number of bytes allocated for the nodes of the hierarchy
+  std::size_t memory_footprint() const noexcept
+  {
+    return Details::KokkosExt::memorySpan(_leaf_nodes) +
+           Details::KokkosExt::memorySpan(_internal_nodes);
+  }
+
+  // Upper bound of the peak memory allocated when constructing a hierarchy
+  // of n values, including the hierarchy itself
+  template <typename SpaceFillingCurve = Experimental::Morton64>
+  static std::size_t construction_memory_estimate(size_type n)
+  {
+    using Coordinate = GeometryTraits::coordinate_type_t<bounding_volume_type>;
+    constexpr int DIM = GeometryTraits::dimension_v<bounding_volume_type>;
+    using Key = std::invoke_result_t<SpaceFillingCurve, Box<DIM, Coordinate>,
+                                     Point<DIM, Coordinate>>;
+    return Details::constructionMemoryEstimate<
+        leaf_node_type, internal_node_type, bounding_volume_type, Key>(n);
+  }
+
+  // Upper bounds of the peak memory allocated by the CRS queries, including
+  // the offsets and the results
+  template <typename OutputValue = value_type>
+  static std::size_t spatial_query_memory_estimate(
+      size_type num_queries, size_type num_results,
+      Experimental::TraversalPolicy const &policy =
+          Experimental::TraversalPolicy())
+  {
+    return Details::spatialQueryMemoryEstimate<OutputValue>(
+        num_queries, num_results, policy);
+  }
+
+  template <typename OutputValue = value_type>
+  static std::size_t nearest_query_memory_estimate(
+      size_type num_queries, int k,
+      Experimental::TraversalPolicy const &policy =
+          Experimental::TraversalPolicy())
+  {
+    using Coordinate = GeometryTraits::coordinate_type_t<bounding_volume_type>;
+    return Details::nearestQueryMemoryEstimate<OutputValue, Coordinate>(
+        num_queries, k, policy);
+  }
+
   template <typename ExecutionSpace, typename Predicates, typename Callback>
   void query(ExecutionSpace const &space, Predicates const &predicates,
              Callback const &callback,
@@ -0,0 +1,256 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#ifndef ARBORX_STREAMED_QUERY_HPP
+#define ARBORX_STREAMED_QUERY_HPP
+
+#include <detail/ArborX_AccessTraits.hpp>
+#include <detail/ArborX_PermutedData.hpp>
+#include <detail/ArborX_TraversalPolicy.hpp>
+#include <misc/ArborX_Exception.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Profiling_ScopedRegion.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace ArborX
+{
+
+namespace Experimental
+{
+
+// Consumer of streamed results on the host, called as
+//   function(first, values, offsets)
+// where values and offsets are host views holding the CRS results of the
+// predicates [first, first + offsets.size() - 1). The views alias buffers
+// reused by later chunks, and must be copied to be kept past the call.
+template <typename Function>
+struct HostSink
+{
+  Function function;
+};
+
+template <typename Function>
+HostSink(Function) -> HostSink<Function>;
+
+} // namespace Experimental
+
+namespace Details
+{
+
+template <typename T>
+struct is_host_sink : std::false_type
+{};
+
+template <typename Function>
+struct is_host_sink<Experimental::HostSink<Function>> : std::true_type
+{};
+
+template <typename OutputValue, typename Tree, typename ExecutionSpace,
+          typename UserPredicates, typename QueryChunk, typename Consumer>
+void streamedQuery(Tree const &tree, ExecutionSpace const &space,
+                   UserPredicates const &user_predicates, int chunk_size,
+                   QueryChunk const &query_chunk, Consumer const &consumer)
+{
+  Kokkos::Profiling::ScopedRegion guard("ArborX::StreamedQuery");
+
+  using MemorySpace = typename Tree::memory_space;
+
+  check_valid_access_traits(user_predicates, CheckReturnTypeTag{});
+  using Predicates = AccessValues<UserPredicates>;
+  Predicates predicates{user_predicates}; // NOLINT
+
+  ARBORX_ASSERT(chunk_size > 0);
+  int const n = predicates.size();
+
+  // Two instances, so that the results of a chunk can be consumed while the
+  // next one is traversed. Kernels on host backends block the calling
+  // thread, so that there is nothing to overlap there and splitting the
+  // resources would only slow down the traversal.
+  ExecutionSpace instances[2] = {space, space};
+  if constexpr (!Kokkos::SpaceAccessibility<ExecutionSpace,
+                                            Kokkos::HostSpace>::accessible)
+  {
+    auto partitions = Kokkos::Experimental::partition_space(space, 1, 1);
+    instances[0] = partitions[0];
+    instances[1] = partitions[1];
+  }
+  space.fence("ArborX::StreamedQuery (wait for the inputs)");
+
+  using Values = Kokkos::View<OutputValue *, MemorySpace>;
+  using Offsets = Kokkos::View<int *, MemorySpace>;
+  Values values[2];
+  Offsets offsets[2];
+  for (int k = 0; k < 2; ++k)
+  {
+    values[k] = Values(
+        Kokkos::view_alloc(instances[k], "ArborX::StreamedQuery::values"), 0);
+    offsets[k] = Offsets(
+        Kokkos::view_alloc(instances[k], "ArborX::StreamedQuery::offsets"), 0);
+  }
+
+  // Results in host-accessible memory are handed over to a host sink as is.
+  // Otherwise, they are copied to page-locked host memory, which lets the
+  // copies overlap with the traversal. Its allocation is expensive and
+  // synchronizes the device, so that the host buffers only grow and the sink
+  // receives their leading parts.
+  constexpr bool is_host_accessible =
+      Kokkos::SpaceAccessibility<Kokkos::HostSpace, MemorySpace>::accessible;
+  using HostValues = std::conditional_t<
+      is_host_accessible, Values,
+      Kokkos::View<OutputValue *, Kokkos::SharedHostPinnedSpace>>;
+  using HostOffsets = std::conditional_t<
+      is_host_accessible, Offsets,
+      Kokkos::View<int *, Kokkos::SharedHostPinnedSpace>>;
+  HostValues host_values[2];
+  HostOffsets host_offsets[2];
+  HostValues host_values_chunk[2];
+  HostOffsets host_offsets_chunk[2];
+
+  int previous_first = -1;
+  int previous_k = 0;
+  for (int first = 0, chunk = 0; first < n; first += chunk_size, ++chunk)
+  {
+    int const k = chunk % 2;
+    auto const &instance = instances[k];
+
+    // The buffers were last used two chunks ago
+    instance.fence("ArborX::StreamedQuery (wait for the buffers)");
+
+    DataChunk<Predicates> predicates_chunk{predicates, first,
+                                           std::min(chunk_size, n - first)};
+    query_chunk(instance, predicates_chunk, values[k], offsets[k]);
+
+    if constexpr (is_host_sink<Consumer>::value)
+    {
+      if constexpr (is_host_accessible)
+      {
+        host_values_chunk[k] = values[k];
+        host_offsets_chunk[k] = offsets[k];
+      }
+      else
+      {
+        // The previous contents were consumed two chunks ago
+        if (host_values[k].size() < values[k].size())
+          host_values[k] = HostValues(
+              Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                                 "ArborX::StreamedQuery::host_values"),
+              values[k].size());
+        if (host_offsets[k].size() < offsets[k].size())
+          host_offsets[k] = HostOffsets(
+              Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                                 "ArborX::StreamedQuery::host_offsets"),
+              offsets[k].size());
+        host_values_chunk[k] = Kokkos::subview(
+            host_values[k], std::make_pair((std::size_t)0, values[k].size()));
+        host_offsets_chunk[k] =
+            Kokkos::subview(host_offsets[k],
+                            std::make_pair((std::size_t)0, offsets[k].size()));
+        Kokkos::deep_copy(instance, host_values_chunk[k], values[k]);
+        Kokkos::deep_copy(instance, host_offsets_chunk[k], offsets[k]);
+      }
+
+      // Hand the previous chunk over while this one is being processed
+      if (previous_first >= 0)
+      {
+        instances[1 - k].fence("ArborX::StreamedQuery (wait for the results)");
+        consumer.function(previous_first, host_values_chunk[1 - k],
+                          host_offsets_chunk[1 - k]);
+      }
+      previous_first = first;
+      previous_k = k;
+    }
+    else
+    {
+      consumer(instance, first, values[k], offsets[k]);
+    }
+  }
+
+  if constexpr (is_host_sink<Consumer>::value)
+  {
+    if (previous_first >= 0)
+    {
+      instances[previous_k].fence(
+          "ArborX::StreamedQuery (wait for the results)");
+      consumer.function(previous_first, host_values_chunk[previous_k],
+                        host_offsets_chunk[previous_k]);
+    }
+  }
+
+  for (auto const &instance : instances)
+    instance.fence("ArborX::StreamedQuery (wait for the consumer)");
+}
+
+} // namespace Details
+
+namespace Experimental
+{
+
+// Streamed CRS query. The predicates are processed in chunks of chunk_size
+// predicates, so that the memory needed for the results is bounded by the
+// size of a chunk rather than by the total output.
+//
+// For each chunk, the consumer is either called as
+//   consumer(exec_space, first, values, offsets)
+// with the results in the memory space of the tree, or it is a HostSink that
+// receives them on the host. The offsets of a chunk start at zero. A device
+// consumer may enqueue work on the given execution space instance and return
+// without waiting for it: the views are only reused two chunks later, after
+// the instance has been fenced. On device backends, the next chunk is
+// traversed on a different instance, concurrently with the consumer. All the
+// work is complete when the function returns.
+template <typename Tree, typename ExecutionSpace, typename UserPredicates,
+          typename Consumer>
+void streamed_query(Tree const &tree, ExecutionSpace const &space,
+                    UserPredicates const &user_predicates, int chunk_size,
+                    Consumer const &consumer,
+                    TraversalPolicy const &policy = TraversalPolicy())
+{
+  static_assert(Kokkos::is_execution_space<ExecutionSpace>::value);
+
+  Details::streamedQuery<typename Tree::value_type>(
+      tree, space, user_predicates, chunk_size,
+      [&tree, &policy](ExecutionSpace const &instance, auto const &predicates,
+                       auto &values, auto &offsets) {
+        tree.query(instance, predicates, values, offsets, policy);
+      },
+      consumer);
+}
+
+// Same with a callback producing values of type OutputValue
+template <typename OutputValue, typename Tree, typename ExecutionSpace,
+          typename UserPredicates, typename Callback, typename Consumer>
+void streamed_query(Tree const &tree, ExecutionSpace const &space,
+                    UserPredicates const &user_predicates, int chunk_size,
+                    Callback const &callback, Consumer const &consumer,
+                    TraversalPolicy const &policy = TraversalPolicy())
+{
+  static_assert(Kokkos::is_execution_space<ExecutionSpace>::value);
+
+  Details::streamedQuery<OutputValue>(
+      tree, space, user_predicates, chunk_size,
+      [&tree, &callback, &policy](ExecutionSpace const &instance,
+                                  auto const &predicates, auto &values,
+                                  auto &offsets) {
+        tree.query(instance, predicates, callback, values, offsets, policy);
+      },
+      consumer);
+}
+
+} // namespace Experimental
+
+} // namespace ArborX
+
+#endif
@@ -0,0 +1,208 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#ifndef ARBORX_TREE_QUALITY_HPP
+#define ARBORX_TREE_QUALITY_HPP
+
+#include <ArborX_GeometryTraits.hpp>
+#include <algorithms/ArborX_Intersects.hpp>
+#include <detail/ArborX_HappyTreeFriends.hpp>
+#include <detail/ArborX_TreeQuality.hpp>
+#include <kokkos_ext/ArborX_KokkosExtAccessibilityTraits.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Profiling_ScopedRegion.hpp>
+
+#include <utility> // swap
+#include <vector>
+
+namespace ArborX
+{
+namespace Experimental
+{
+
+struct TreeQuality
+{
+  // Surface area heuristic cost, relative to the surface area of the root
+  double sah_cost = 0;
+  // Effective primitive overlap cost (Aila et al., 2013): the part of the
+  // SAH cost due to the leaves overlapping nodes that do not contain them,
+  // relative to the surface area of the root. Always zero when the leaves
+  // are points, since their bounding boxes have no area.
+  double epo_cost = 0;
+  double average_leaf_depth = 0;
+  int max_leaf_depth = 0;
+  // Sum of the overlap volumes of the sibling nodes, relative to the volume
+  // of the root
+  double sibling_overlap = 0;
+  // Number of nodes and their average surface area, relative to the surface
+  // area of the root, at each depth
+  std::vector<int> level_num_nodes;
+  std::vector<double> level_average_area;
+};
+
+// Quality metrics of a hierarchy, which explain the cost of the queries
+// independently of the queries themselves. The bounding boxes of the leaves
+// are used in place of their indexables.
+template <typename ExecutionSpace, typename Tree>
+TreeQuality treeQuality(ExecutionSpace const &space, Tree const &tree)
+{
+  Kokkos::Profiling::ScopedRegion guard("ArborX::TreeQuality");
+
+  using MemorySpace = typename Tree::memory_space;
+  static_assert(
+      Details::KokkosExt::is_accessible_from<MemorySpace,
+                                             ExecutionSpace>::value,
+      "Tree must be accessible from the execution space");
+  using Box = typename Tree::bounding_volume_type;
+  static_assert(GeometryTraits::is_box_v<Box>);
+
+  using Details::HappyTreeFriends;
+
+  TreeQuality quality;
+  int const n = tree.size();
+  if (n == 0)
+    return quality;
+  if (n == 1)
+  {
+    quality.sah_cost = Details::sah_leaf_cost;
+    quality.level_num_nodes = {1};
+    quality.level_average_area = {1};
+    return quality;
+  }
+
+  int const root = HappyTreeFriends::getRoot(tree);
+  int const num_nodes = 2 * n - 1;
+
+  // Traverse the hierarchy level by level to find the depths of the nodes
+  Kokkos::Profiling::pushRegion("ArborX::TreeQuality::depths");
+  Kokkos::View<int *, MemorySpace> depths(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                         "ArborX::TreeQuality::depths"),
+      num_nodes);
+  Kokkos::View<int *, MemorySpace> frontier(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                         "ArborX::TreeQuality::frontier"),
+      n);
+  Kokkos::View<int *, MemorySpace> next_frontier(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                         "ArborX::TreeQuality::next_frontier"),
+      n);
+  Kokkos::deep_copy(space, Kokkos::subview(frontier, 0), root);
+  Kokkos::deep_copy(space, Kokkos::subview(depths, root), 0);
+  int level_size = 1;
+  for (int level = 0; level_size > 0; ++level)
+  {
+    quality.level_num_nodes.push_back(level_size);
+    auto const current =
+        Kokkos::subview(frontier, Kokkos::make_pair(0, level_size));
+    Kokkos::parallel_scan(
+        "ArborX::TreeQuality::next_level",
+        Kokkos::RangePolicy(space, 0, level_size),
+        KOKKOS_LAMBDA(int k, int &update, bool final_pass) {
+          int const node = current(k);
+          if (HappyTreeFriends::isLeaf(tree, node))
+            return;
+          if (final_pass)
+          {
+            int const left = HappyTreeFriends::getLeftChild(tree, node);
+            int const right = HappyTreeFriends::getRightChild(tree, node);
+            next_frontier(update) = left;
+            next_frontier(update + 1) = right;
+            depths(left) = level + 1;
+            depths(right) = level + 1;
+          }
+          update += 2;
+        },
+        level_size);
+    std::swap(frontier, next_frontier);
+  }
+  int const num_levels = quality.level_num_nodes.size();
+  quality.max_leaf_depth = num_levels - 1;
+  Kokkos::Profiling::popRegion();
+
+  Kokkos::Profiling::pushRegion("ArborX::TreeQuality::metrics");
+
+  double const root_area = Details::boxSurfaceArea(tree.bounds());
+  double const root_volume = Details::boxVolume(tree.bounds());
+
+  Kokkos::View<double *, MemorySpace> level_areas(
+      "ArborX::TreeQuality::level_areas", num_levels);
+  double sah_cost;
+  Kokkos::parallel_reduce(
+      "ArborX::TreeQuality::sah", Kokkos::RangePolicy(space, 0, num_nodes),
+      KOKKOS_LAMBDA(int node, double &update) {
+        auto const area =
+            Details::boxSurfaceArea(Details::nodeBoundingBox(tree, node));
+        Kokkos::atomic_add(&level_areas(depths(node)), area);
+        update += (HappyTreeFriends::isLeaf(tree, node)
+                       ? Details::sah_leaf_cost
+                       : Details::sah_internal_cost) *
+                  area;
+      },
+      sah_cost);
+
+  long long sum_leaf_depths;
+  Kokkos::parallel_reduce(
+      "ArborX::TreeQuality::leaf_depths", Kokkos::RangePolicy(space, 0, n),
+      KOKKOS_LAMBDA(int leaf, long long &update) { update += depths(leaf); },
+      sum_leaf_depths);
+
+  double sibling_overlap;
+  Kokkos::parallel_reduce(
+      "ArborX::TreeQuality::sibling_overlap",
+      Kokkos::RangePolicy(space, n, num_nodes),
+      KOKKOS_LAMBDA(int node, double &update) {
+        auto const left_box = Details::nodeBoundingBox(
+            tree, HappyTreeFriends::getLeftChild(tree, node));
+        auto const right_box = Details::nodeBoundingBox(
+            tree, HappyTreeFriends::getRightChild(tree, node));
+        if (Details::intersects(left_box, right_box))
+          update +=
+              Details::boxVolume(Details::boxIntersection(left_box, right_box));
+      },
+      sibling_overlap);
+
+  double epo_cost;
+  Kokkos::parallel_reduce(
+      "ArborX::TreeQuality::epo", Kokkos::RangePolicy(space, 0, n),
+      KOKKOS_LAMBDA(int leaf, double &update) {
+        update += Details::leafOverlapCost(tree, leaf, depths(leaf));
+      },
+      epo_cost);
+
+  auto level_areas_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, level_areas);
+
+  Kokkos::Profiling::popRegion();
+
+  // Degenerate roots (e.g., all the indexables at the same location) leave
+  // the relative metrics at zero
+  quality.average_leaf_depth = (double)sum_leaf_depths / n;
+  quality.level_average_area.resize(num_levels);
+  if (root_area > 0)
+  {
+    quality.sah_cost = sah_cost / root_area;
+    quality.epo_cost = epo_cost / root_area;
+    for (int level = 0; level < num_levels; ++level)
+      quality.level_average_area[level] =
+          level_areas_host(level) / quality.level_num_nodes[level] / root_area;
+  }
+  if (root_volume > 0)
+    quality.sibling_overlap = sibling_overlap / root_volume;
+
+  return quality;
+}
+
+} // namespace Experimental
+} // namespace ArborX
+
+#endif
@@ -193,7 +193,8 @@ void queryImpl(ExecutionSpace const &space, Tree const &tree,
   Kokkos::Profiling::pushRegion(
       "ArborX::CrsGraphWrapper::first_pass_postprocess");
 
-  OffsetView preallocated_offset("ArborX::CrsGraphWrapper::offset_copy", 0);
+  OffsetView preallocated_offset(
+      Kokkos::view_alloc(space, "ArborX::CrsGraphWrapper::offset_copy"), 0);
   if (underflow)
   {
     // Store a copy of the original offset. We'll need it for compression.
@@ -283,6 +284,59 @@ struct Iota
   KOKKOS_FUNCTION unsigned int operator()(int const i) const { return i; }
 };
 
+// Estimate the number of results per query from a sample of the predicates.
+// The buffer size is the largest count in the sample, with some margin for
+// the queries that were not sampled. Returns zero, i.e. no buffer, if no
+// results are expected or if the buffer would be much larger than the
+// expected total number of results, in which case the second pass is
+// cheaper than the memory wasted.
+template <typename OutputView, typename ExecutionSpace, typename Tree,
+          typename Predicates, typename Callback>
+int estimateBufferSize(ExecutionSpace const &space, Tree const &tree,
+                       Predicates const &predicates, Callback const &callback)
+{
+  int const n_queries = predicates.size();
+  if (n_queries == 0)
+    return 0;
+
+  constexpr int max_sample_size = 1024;
+  int const stride = (n_queries + max_sample_size - 1) / max_sample_size;
+  SampledData<Predicates> sampled_predicates{predicates, stride};
+  int const sample_size = sampled_predicates.size();
+
+  using CountView = Kokkos::View<int *, typename Tree::memory_space>;
+  CountView counts(
+      Kokkos::view_alloc(space, "ArborX::CrsGraphWrapper::sample_counts"),
+      sample_size);
+  tree.query(
+      space, sampled_predicates,
+      InsertGenerator<FirstPassNoBufferOptimizationTag, Callback, OutputView,
+                      CountView, CountView>{callback, OutputView{}, counts,
+                                            CountView{}},
+      ArborX::Experimental::TraversalPolicy().setPredicateSorting(false));
+
+  int max_count = 0;
+  long long total_count = 0;
+  Kokkos::parallel_reduce(
+      "ArborX::CrsGraphWrapper::sample_statistics",
+      Kokkos::RangePolicy(space, 0, sample_size),
+      KOKKOS_LAMBDA(int i, int &max_update, long long &total_update) {
+        if (counts(i) > max_update)
+          max_update = counts(i);
+        total_update += counts(i);
+      },
+      Kokkos::Max<int>(max_count), total_count);
+
+  if (max_count == 0)
+    return 0;
+
+  int const buffer_size = max_count + (max_count + 3) / 4;
+  constexpr int max_waste_factor = 4;
+  if ((long long)buffer_size * sample_size > max_waste_factor * total_count)
+    return 0;
+  return buffer_size;
+}
+
 template <typename Tag, typename ExecutionSpace, typename Predicates,
           typename OffsetView, typename OutView>
 std::enable_if_t<std::is_same_v<Tag, SpatialPredicateTag> ||
@@ -364,15 +418,28 @@ queryDispatch(Tag, Tree const &tree, ExecutionSpace const &space,
 
   Kokkos::Profiling::pushRegion(profiling_prefix);
 
+  int buffer_size = policy._buffer_size;
+  if constexpr (std::is_same_v<Tag, SpatialPredicateTag>)
+  {
+    if (buffer_size == 0 && policy._estimate_buffer_size)
+    {
+      Kokkos::Profiling::pushRegion(profiling_prefix +
+                                    "::estimate_buffer_size");
+      buffer_size =
+          estimateBufferSize<OutputView>(space, tree, predicates, callback);
+      Kokkos::Profiling::popRegion();
+    }
+  }
+
   Kokkos::Profiling::pushRegion(profiling_prefix + "::init_and_alloc");
 
   allocateAndInitializeStorage(Tag{}, space, predicates, offset, out,
-                               policy._buffer_size);
+                               buffer_size);
 
   Kokkos::Profiling::popRegion();
 
   auto buffer_status = (std::is_same<Tag, SpatialPredicateTag>{}
-                            ? toBufferStatus(policy._buffer_size)
+                            ? toBufferStatus(buffer_size)
                             : BufferStatus::PreallocationSoft);
 
   if (policy._sort_predicates)
@@ -427,7 +494,7 @@ queryDispatch(Tag, Tree const &tree, ExecutionSpace const &space,
   using MemorySpace = typename Tree::memory_space;
 
   Kokkos::View<typename Tree::value_type *, MemorySpace> indices(
-      "ArborX::CrsGraphWrapper::query::indices", 0);
+      Kokkos::view_alloc(space, "ArborX::CrsGraphWrapper::query::indices"), 0);
   queryDispatch(Tag{}, tree, space, predicates, DefaultCallback{}, indices,
                 offset, policy);
   callback(predicates, offset, indices, out);
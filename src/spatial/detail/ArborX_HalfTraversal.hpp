@@ -14,6 +14,7 @@
 
 #include <detail/ArborX_HappyTreeFriends.hpp>
 #include <detail/ArborX_Node.hpp> // ROPE_SENTINEL
+#include <detail/ArborX_Predicates.hpp>
 
 #include <Kokkos_Core.hpp>
 
@@ -65,10 +66,11 @@ struct HalfTraversal
       }
       else
       {
-        node =
-            (predicate(HappyTreeFriends::getInternalBoundingVolume(_bvh, node))
-                 ? HappyTreeFriends::getLeftChild(_bvh, node)
-                 : HappyTreeFriends::getRope(_bvh, node));
+        node = (overlapsSubtree(
+                    predicate,
+                    HappyTreeFriends::getInternalBoundingVolume(_bvh, node))
+                    ? HappyTreeFriends::getLeftChild(_bvh, node)
+                    : HappyTreeFriends::getRope(_bvh, node));
       }
     }
   }
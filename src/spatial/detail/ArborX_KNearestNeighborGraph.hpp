@@ -0,0 +1,159 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#ifndef ARBORX_K_NEAREST_NEIGHBOR_GRAPH_HPP
+#define ARBORX_K_NEAREST_NEIGHBOR_GRAPH_HPP
+
+#include <algorithms/ArborX_Distance.hpp>
+#include <detail/ArborX_HappyTreeFriends.hpp>
+#include <detail/ArborX_Node.hpp> // ROPE_SENTINEL
+#include <kokkos_ext/ArborX_KokkosExtArithmeticTraits.hpp>
+
+#include <Kokkos_Core.hpp>
+
+namespace ArborX::Details
+{
+
+// Find the k nearest neighbors of each indexed point among the other points.
+//
+// The leaves of the hierarchy are in the space-filling curve order. Each
+// thread processes a chunk of consecutive leaves, so that every query is
+// seeded with the neighbors of its predecessor (which are close by). The
+// k-th of these candidates bounds the search radius before the traversal
+// starts. Distances are symmetric: when a traversal computes the distance
+// to a point of the same chunk that is yet to be processed, the query point
+// is also offered to that point's list.
+//
+// The neighbors of the point i are stored, sorted by distance, in the row
+// [i * k, (i + 1) * k) of the indices and distances views.
+template <class BVH, class Points, class Indices, class Distances,
+          class Counts>
+struct KNearestNeighborGraphTraversal
+{
+  static constexpr int chunk_size = 32;
+
+  BVH _bvh;
+  Points _points;
+  int _k;
+  Indices _indices;
+  Distances _distances;
+  Counts _counts;
+
+  template <class ExecutionSpace>
+  KNearestNeighborGraphTraversal(ExecutionSpace const &space, BVH const &bvh,
+                                 Points const &points, int k,
+                                 Indices const &indices,
+                                 Distances const &distances,
+                                 Counts const &counts)
+      : _bvh{bvh}
+      , _points{points}
+      , _k{k}
+      , _indices{indices}
+      , _distances{distances}
+      , _counts{counts}
+  {
+    if (_bvh.size() <= 1 || _k == 0)
+      return;
+
+    int const num_chunks = (_bvh.size() + chunk_size - 1) / chunk_size;
+    Kokkos::parallel_for("ArborX::Experimental::KNearestNeighborGraph",
+                         Kokkos::RangePolicy(space, 0, num_chunks), *this);
+  }
+
+  KOKKOS_FUNCTION auto radius(int i) const
+  {
+    using Distance = typename Distances::non_const_value_type;
+    return (_counts(i) < _k
+                ? KokkosExt::ArithmeticTraits::infinity<Distance>::value
+                : _distances(i * _k + _k - 1));
+  }
+
+  // Insert the neighbor j of the point i, keeping the row sorted
+  template <typename Distance>
+  KOKKOS_FUNCTION void insert(int i, int j, Distance d) const
+  {
+    int const count = _counts(i);
+    int const row = i * _k;
+    if (count == _k && !(d < _distances(row + _k - 1)))
+      return;
+    for (int m = 0; m < count; ++m)
+      if (_indices(row + m) == j)
+        return;
+
+    int pos = (count < _k ? count : _k - 1);
+    for (; pos > 0 && _distances(row + pos - 1) > d; --pos)
+    {
+      _indices(row + pos) = _indices(row + pos - 1);
+      _distances(row + pos) = _distances(row + pos - 1);
+    }
+    _indices(row + pos) = j;
+    _distances(row + pos) = d;
+    if (count < _k)
+      _counts(i) = count + 1;
+  }
+
+  KOKKOS_FUNCTION void operator()(int chunk) const
+  {
+    int const n = _bvh.size();
+    int const begin = chunk * chunk_size;
+    int const end = Kokkos::min(begin + chunk_size, n);
+
+    for (int leaf = begin; leaf < end; ++leaf)
+    {
+      int const i = HappyTreeFriends::getValue(_bvh, leaf).index;
+      auto const &point = _points(i);
+
+      if (leaf > begin)
+      {
+        int const predecessor =
+            HappyTreeFriends::getValue(_bvh, leaf - 1).index;
+        insert(i, predecessor, Details::distance(point, _points(predecessor)));
+        int const row = predecessor * _k;
+        for (int m = 0; m < _counts(predecessor); ++m)
+        {
+          int const j = _indices(row + m);
+          if (j != i)
+            insert(i, j, Details::distance(point, _points(j)));
+        }
+      }
+
+      int node = HappyTreeFriends::getRoot(_bvh);
+      do
+      {
+        if (HappyTreeFriends::isLeaf(_bvh, node))
+        {
+          if (node != leaf)
+          {
+            int const j = HappyTreeFriends::getValue(_bvh, node).index;
+            auto const d = Details::distance(
+                point, HappyTreeFriends::getIndexable(_bvh, node));
+            if (node > leaf && node < end)
+              insert(j, i, d);
+            insert(i, j, d);
+          }
+          node = HappyTreeFriends::getRope(_bvh, node);
+        }
+        else
+        {
+          auto const &bounding_volume =
+              HappyTreeFriends::getInternalBoundingVolume(_bvh, node);
+          node = (Details::distance(point, bounding_volume) < radius(i)
+                      ? HappyTreeFriends::getLeftChild(_bvh, node)
+                      : HappyTreeFriends::getRope(_bvh, node));
+        }
+      } while (node != ROPE_SENTINEL);
+    }
+  }
+};
+
+} // namespace ArborX::Details
+
+#endif
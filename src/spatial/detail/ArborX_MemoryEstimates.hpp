@@ -0,0 +1,129 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#ifndef ARBORX_DETAILS_MEMORY_ESTIMATES_HPP
+#define ARBORX_DETAILS_MEMORY_ESTIMATES_HPP
+
+#include <detail/ArborX_TraversalPolicy.hpp>
+
+#include <Kokkos_Pair.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+// Upper bounds, in bytes, of the memory allocated by the tree construction
+// and by the queries. They mirror the allocations of the implementation, and
+// must be kept in sync with it.
+namespace ArborX::Details
+{
+
+// Sorting keys along with the permutation (sortByKey). The radix sorts of the
+// vendor libraries double buffer the keys and the values, while the Kokkos bin
+// sort needs the bins, the permutation vector, and a copy of the keys or of
+// the values.
+template <typename Key, typename Value = unsigned int>
+std::size_t sortMemoryEstimate(std::size_t n)
+{
+  return n * (sizeof(Key) + sizeof(Value) + 2 * sizeof(unsigned int));
+}
+
+// Construction of a BVH with n values: the tree itself, the codes along the
+// space-filling curve and the permutation, and then either the sort or the
+// ranges used to generate the hierarchy. The bounding volume of the scene is
+// also reduced on the device.
+template <typename LeafNode, typename InternalNode, typename BoundingVolume,
+          typename Key>
+std::size_t constructionMemoryEstimate(std::size_t n)
+{
+  if (n == 0)
+    return 0;
+  std::size_t const tree = n * sizeof(LeafNode) +
+                           (n - 1) * sizeof(InternalNode) +
+                           sizeof(BoundingVolume);
+  if (n == 1)
+    return tree;
+  return tree + n * (sizeof(Key) + sizeof(unsigned int)) +
+         std::max(sortMemoryEstimate<Key>(n), (n - 1) * sizeof(int));
+}
+
+// Peak memory and memory kept until the end of the traversal of the
+// permutation sorting the predicates along the Morton curve
+struct PredicatesPermutationEstimate
+{
+  std::size_t peak;
+  std::size_t kept;
+};
+
+inline PredicatesPermutationEstimate
+predicatesPermutationMemoryEstimate(std::size_t num_queries,
+                                    Experimental::TraversalPolicy const &policy)
+{
+  if (!policy._sort_predicates)
+    return {0, 0};
+  using Key = std::uint32_t; // Morton32
+  return {num_queries * (sizeof(Key) + sizeof(unsigned int)) +
+              sortMemoryEstimate<Key>(num_queries),
+          num_queries * sizeof(unsigned int)};
+}
+
+// CRS spatial query with num_results results, including the offsets and the
+// results themselves. With a buffer, the results are first written in the
+// preallocated storage, which is either compacted or discarded for a second
+// pass. A buffer size picked by the estimation is not accounted for.
+template <typename OutputValue>
+std::size_t
+spatialQueryMemoryEstimate(std::size_t num_queries, std::size_t num_results,
+                           Experimental::TraversalPolicy const &policy)
+{
+  std::size_t const offset = (num_queries + 1) * sizeof(int);
+  std::size_t const results = num_results * sizeof(OutputValue);
+  std::size_t const counts = num_queries * sizeof(int);
+  std::size_t const buffer =
+      num_queries * std::abs(policy._buffer_size) * sizeof(OutputValue);
+  auto const permutation =
+      predicatesPermutationMemoryEstimate(num_queries, policy);
+
+  std::size_t const first_pass =
+      offset + buffer + std::max(permutation.peak, permutation.kept + counts);
+  std::size_t second_pass;
+  if (policy._buffer_size != 0 && buffer > results)
+    second_pass =
+        offset + buffer + permutation.kept + counts + offset + results;
+  else
+    second_pass = offset + permutation.kept + counts + results;
+  return std::max(first_pass, second_pass);
+}
+
+// CRS nearest query with k neighbors per query, assuming the tree contains at
+// least k values. The traversal stores the candidates in a heap for each
+// query.
+template <typename OutputValue, typename Coordinate>
+std::size_t nearestQueryMemoryEstimate(
+    std::size_t num_queries, int k, Experimental::TraversalPolicy const &policy)
+{
+  std::size_t const offset = (num_queries + 1) * sizeof(int);
+  std::size_t const results = num_queries * k * sizeof(OutputValue);
+  std::size_t const counts = num_queries * sizeof(int);
+  std::size_t const heaps =
+      (num_queries + 1) * sizeof(int) +
+      num_queries * k * sizeof(Kokkos::pair<int, Coordinate>);
+  auto const permutation =
+      predicatesPermutationMemoryEstimate(num_queries, policy);
+
+  return offset + results +
+         std::max(permutation.peak, permutation.kept + counts + heaps);
+}
+
+} // namespace ArborX::Details
+
+#endif
@@ -37,8 +37,12 @@ struct NearestBufferProvider
   template <typename ExecutionSpace, typename Predicates>
   NearestBufferProvider(ExecutionSpace const &space,
                         Predicates const &predicates)
-      : _buffer("ArborX::NearestBufferProvider::buffer", 0)
-      , _offset("ArborX::NearestBufferProvider::offset", 0)
+      : _buffer(Kokkos::view_alloc(space,
+                                   "ArborX::NearestBufferProvider::buffer"),
+                0)
+      , _offset(Kokkos::view_alloc(space,
+                                   "ArborX::NearestBufferProvider::offset"),
+                0)
   {
     allocateBuffer(space, predicates);
   }
@@ -16,6 +16,7 @@
 #include <ArborX_LinearBVH.hpp>
 #include <ArborX_Sphere.hpp>
 #include <detail/ArborX_HalfTraversal.hpp>
+#include <detail/ArborX_KNearestNeighborGraph.hpp>
 #include <kokkos_ext/ArborX_KokkosExtStdAlgorithms.hpp>
 #include <kokkos_ext/ArborX_KokkosExtViewHelpers.hpp> // reallocWithoutInitializing
 
@@ -181,6 +182,56 @@ void findFullNeighborList(ExecutionSpace const &space,
   Kokkos::Profiling::popRegion();
 }
 
+// Build the graph connecting each point to its k nearest neighbors among the
+// other points. The graph is k-regular (k is reduced to the number of points
+// minus one if needed): the neighbors of the point i are stored in
+// indices(offsets(i):offsets(i+1)), sorted by increasing distance, with the
+// distances stored alongside.
+template <class ExecutionSpace, class Primitives, class Offsets, class Indices,
+          class Distances>
+void findKNearestNeighborGraph(ExecutionSpace const &space,
+                               Primitives const &primitives, int k,
+                               Offsets &offsets, Indices &indices,
+                               Distances &distances)
+{
+  Kokkos::Profiling::pushRegion("ArborX::Experimental::KNearestNeighborGraph");
+
+  namespace KokkosExt = ArborX::Details::KokkosExt;
+
+  using Points = Details::AccessValues<Primitives>;
+
+  using MemorySpace = typename Points::memory_space;
+  static_assert(
+      KokkosExt::is_accessible_from<MemorySpace, ExecutionSpace>::value,
+      "Primitives must be accessible from the execution space");
+
+  using Point = typename Points::value_type;
+  static_assert(GeometryTraits::is_point_v<Point>);
+
+  KOKKOS_ASSERT(k >= 0);
+
+  Points points{primitives}; // NOLINT
+  int const n = points.size();
+  k = Kokkos::max(Kokkos::min(k, n - 1), 0);
+
+  KokkosExt::reallocWithoutInitializing(space, offsets, n + 1);
+  Kokkos::parallel_for(
+      "ArborX::Experimental::KNearestNeighborGraph::offsets",
+      Kokkos::RangePolicy(space, 0, n + 1),
+      KOKKOS_LAMBDA(int i) { offsets(i) = i * k; });
+  KokkosExt::reallocWithoutInitializing(space, indices, n * k);
+  KokkosExt::reallocWithoutInitializing(space, distances, n * k);
+
+  BoundingVolumeHierarchy bvh(space, Experimental::attach_indices(points));
+
+  Kokkos::View<int *, MemorySpace> counts(
+      "ArborX::Experimental::KNearestNeighborGraph::counts", n);
+  Details::KNearestNeighborGraphTraversal(space, bvh, points, k, indices,
+                                          distances, counts);
+
+  Kokkos::Profiling::popRegion();
+}
+
 } // namespace ArborX::Experimental
 
 #endif
@@ -61,6 +61,59 @@ public:
   using self_type = PermutedData<Data, Permute, AttachIndices>;
 };
 
+// Every stride-th element of the data, with its index in the sample attached
+template <typename Data>
+struct SampledData
+{
+  using memory_space = typename Data::memory_space;
+  using value_type =
+      std::decay_t<decltype(attach(std::declval<Data const &>()(0), 0))>;
+
+  Data _data;
+  int _stride;
+
+  KOKKOS_FUNCTION decltype(auto) operator()(int i) const
+  {
+    return attach(_data(i * _stride), i);
+  }
+  KOKKOS_FUNCTION auto size() const
+  {
+    return (_data.size() + _stride - 1) / _stride;
+  }
+};
+
+template <typename Data>
+class AccessValuesI<SampledData<Data>> : public SampledData<Data>
+{
+public:
+  using self_type = SampledData<Data>;
+};
+
+// Contiguous range [first, first + size) of the data
+template <typename Data>
+struct DataChunk
+{
+  using memory_space = typename Data::memory_space;
+  using value_type = typename Data::value_type;
+
+  Data _data;
+  int _first;
+  int _size;
+
+  KOKKOS_FUNCTION decltype(auto) operator()(int i) const
+  {
+    return _data(_first + i);
+  }
+  KOKKOS_FUNCTION auto size() const { return _size; }
+};
+
+template <typename Data>
+class AccessValuesI<DataChunk<Data>> : public DataChunk<Data>
+{
+public:
+  using self_type = DataChunk<Data>;
+};
+
 } // namespace Details
 
 template <typename Predicates, typename Permute, bool AttachIndices>
@@ -84,6 +137,45 @@ struct AccessTraits<Details::PermutedData<Predicates, Permute, AttachIndices>>
   }
 };
 
+template <typename Predicates>
+struct AccessTraits<Details::SampledData<Predicates>>
+{
+  using SampledPredicates = Details::SampledData<Predicates>;
+
+  using memory_space = typename Predicates::memory_space;
+
+  KOKKOS_FUNCTION static std::size_t
+  size(SampledPredicates const &sampled_predicates)
+  {
+    return sampled_predicates.size();
+  }
+
+  KOKKOS_FUNCTION static decltype(auto)
+  get(SampledPredicates const &sampled_predicates, std::size_t index)
+  {
+    return sampled_predicates(index);
+  }
+};
+
+template <typename Predicates>
+struct AccessTraits<Details::DataChunk<Predicates>>
+{
+  using PredicatesChunk = Details::DataChunk<Predicates>;
+
+  using memory_space = typename Predicates::memory_space;
+
+  KOKKOS_FUNCTION static std::size_t size(PredicatesChunk const &chunk)
+  {
+    return chunk.size();
+  }
+
+  KOKKOS_FUNCTION static decltype(auto) get(PredicatesChunk const &chunk,
+                                            std::size_t index)
+  {
+    return chunk(index);
+  }
+};
+
 } // namespace ArborX
 
 #endif
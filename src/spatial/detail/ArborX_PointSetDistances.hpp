@@ -0,0 +1,563 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#ifndef ARBORX_POINT_SET_DISTANCES_HPP
+#define ARBORX_POINT_SET_DISTANCES_HPP
+
+#include <ArborX_Box.hpp>
+#include <ArborX_GeometryTraits.hpp>
+#include <ArborX_LinearBVH.hpp>
+#include <algorithms/ArborX_Distance.hpp>
+#include <algorithms/ArborX_Expand.hpp>
+#include <detail/ArborX_AccessTraits.hpp>
+#include <detail/ArborX_HappyTreeFriends.hpp>
+#include <detail/ArborX_Predicates.hpp>
+#include <detail/ArborX_Node.hpp> // ROPE_SENTINEL
+#include <kokkos_ext/ArborX_KokkosExtArithmeticTraits.hpp>
+#include <kokkos_ext/ArborX_KokkosExtAccessibilityTraits.hpp>
+#include <misc/ArborX_Exception.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Profiling_ScopedRegion.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace ArborX::Details
+{
+
+// The set-level distances below are computed with a dual traversal. The
+// points of the first set are processed in chunks of consecutive leaves of
+// their own hierarchy (i.e., in space-filling curve order), and each chunk is
+// matched against the hierarchy of the second set.
+constexpr int point_set_chunk_size = 32;
+
+template <class BVH>
+KOKKOS_FUNCTION auto chunkRange(BVH const &bvh, int chunk)
+{
+  int const n = bvh.size();
+  int const begin = chunk * point_set_chunk_size;
+  return Kokkos::make_pair(begin,
+                           Kokkos::min(begin + point_set_chunk_size, n));
+}
+
+template <class BVH>
+int numChunks(BVH const &bvh)
+{
+  return (bvh.size() + point_set_chunk_size - 1) / point_set_chunk_size;
+}
+
+// Update the nearest point (distance and index) of the tree to a point. The
+// search starts with the given candidate, if any, as an upper bound, and
+// stops as soon as the distance drops to the threshold.
+template <class BVH, class Point, class Distance>
+KOKKOS_FUNCTION void updateNearest(BVH const &bvh, Point const &point,
+                                   Distance &best, int &best_index,
+                                   Distance threshold)
+{
+  auto check_leaf = [&](int leaf) {
+    auto const d =
+        Details::distance(point, HappyTreeFriends::getIndexable(bvh, leaf));
+    if (d < best)
+    {
+      best = d;
+      best_index = HappyTreeFriends::getValue(bvh, leaf).index;
+    }
+  };
+
+  if (bvh.size() == 1)
+  {
+    check_leaf(0);
+    return;
+  }
+
+  int node = HappyTreeFriends::getRoot(bvh);
+  do
+  {
+    if (best <= threshold)
+      return;
+    if (HappyTreeFriends::isLeaf(bvh, node))
+    {
+      check_leaf(node);
+      node = HappyTreeFriends::getRope(bvh, node);
+    }
+    else
+    {
+      auto const &bounding_volume =
+          HappyTreeFriends::getInternalBoundingVolume(bvh, node);
+      node = (Details::distance(point, bounding_volume) < best
+                  ? HappyTreeFriends::getLeftChild(bvh, node)
+                  : HappyTreeFriends::getRope(bvh, node));
+    }
+  } while (node != ROPE_SENTINEL);
+}
+
+// Farthest distance from a point to a box
+template <class Point, class Box>
+KOKKOS_FUNCTION auto maxDistanceToBox(Point const &point, Box const &box)
+{
+  constexpr int DIM = GeometryTraits::dimension_v<Point>;
+  Point farthest;
+  for (int d = 0; d < DIM; ++d)
+    farthest[d] = (point[d] - box.minCorner()[d] >
+                           box.maxCorner()[d] - point[d]
+                       ? box.minCorner()[d]
+                       : box.maxCorner()[d]);
+  return Details::distance(point, farthest);
+}
+
+template <class BVH>
+KOKKOS_FUNCTION auto chunkBoundingBox(BVH const &bvh, int begin, int end)
+{
+  typename BVH::bounding_volume_type box;
+  for (int leaf = begin; leaf < end; ++leaf)
+    Details::expand(box, HappyTreeFriends::getIndexable(bvh, leaf));
+  return box;
+}
+
+// Closest pair: the chunk bounding box against the nodes of the second
+// hierarchy gives the node-pair distance bound, compared to the global
+// best-so-far distance. Other chunks update it concurrently, so that it is
+// read atomically.
+template <class BVH1, class BVH2, class Best, class ChunkBest,
+          class ChunkPairs>
+struct ClosestPairSearch
+{
+  BVH1 _bvh1;
+  BVH2 _bvh2;
+  Best _best;
+  ChunkBest _chunk_best;
+  ChunkPairs _chunk_pairs;
+
+  KOKKOS_FUNCTION void operator()(int chunk) const
+  {
+    auto const range = chunkRange(_bvh1, chunk);
+    int const begin = range.first;
+    int const end = range.second;
+    auto const box = chunkBoundingBox(_bvh1, begin, end);
+
+    using Distance = typename Best::non_const_value_type;
+    auto local_best = KokkosExt::ArithmeticTraits::infinity<Distance>::value;
+    Kokkos::pair<int, int> local_pair{-1, -1};
+
+    auto check_leaf = [&](int leaf) {
+      auto const &point2 = HappyTreeFriends::getIndexable(_bvh2, leaf);
+      for (int leaf1 = begin; leaf1 < end; ++leaf1)
+      {
+        auto const d = Details::distance(
+            HappyTreeFriends::getIndexable(_bvh1, leaf1), point2);
+        if (d < local_best)
+        {
+          local_best = d;
+          local_pair = {HappyTreeFriends::getValue(_bvh1, leaf1).index,
+                        HappyTreeFriends::getValue(_bvh2, leaf).index};
+        }
+      }
+      if (local_best < Kokkos::atomic_load(&_best()))
+        Kokkos::atomic_min(&_best(), local_best);
+    };
+
+    if (_bvh2.size() == 1)
+      check_leaf(0);
+    else
+    {
+      int node = HappyTreeFriends::getRoot(_bvh2);
+      do
+      {
+        if (HappyTreeFriends::isLeaf(_bvh2, node))
+        {
+          check_leaf(node);
+          node = HappyTreeFriends::getRope(_bvh2, node);
+        }
+        else
+        {
+          auto const &bounding_volume =
+              HappyTreeFriends::getInternalBoundingVolume(_bvh2, node);
+          auto const bound =
+              Kokkos::min(local_best, Kokkos::atomic_load(&_best()));
+          node = (Details::distance(box, bounding_volume) < bound
+                      ? HappyTreeFriends::getLeftChild(_bvh2, node)
+                      : HappyTreeFriends::getRope(_bvh2, node));
+        }
+      } while (node != ROPE_SENTINEL);
+    }
+
+    _chunk_best(chunk) = local_best;
+    _chunk_pairs(chunk) = local_pair;
+  }
+};
+
+// Directed Hausdorff distance: a point whose nearest neighbor distance cannot
+// exceed the global best-so-far (the current maximum) does not contribute,
+// so its search stops as soon as a close enough point is found. Each search
+// is seeded with the nearest neighbor of the previous point of the chunk,
+// which often settles it immediately. Once a candidate is known, the rest of
+// the chunk is skipped if its bounding box lies within the current maximum of
+// the candidate. As for the closest pair, the maximum is read atomically.
+template <class BVH1, class BVH2, class Points2, class Best>
+struct DirectedHausdorffSearch
+{
+  BVH1 _bvh1;
+  BVH2 _bvh2;
+  Points2 _points2;
+  Best _max;
+
+  KOKKOS_FUNCTION void operator()(int chunk) const
+  {
+    using Distance = typename Best::non_const_value_type;
+    constexpr auto inf = KokkosExt::ArithmeticTraits::infinity<Distance>::value;
+
+    auto const range = chunkRange(_bvh1, chunk);
+    int const begin = range.first;
+    int const end = range.second;
+    int candidate = -1;
+    for (int leaf = begin; leaf < end; ++leaf)
+    {
+      auto const &point = HappyTreeFriends::getIndexable(_bvh1, leaf);
+      auto const current_max = Kokkos::atomic_load(&_max());
+
+      Distance best = inf;
+      int best_index = -1;
+      if (candidate >= 0)
+      {
+        best = Details::distance(point, _points2(candidate));
+        best_index = candidate;
+        if (best <= current_max)
+          continue;
+      }
+      updateNearest(_bvh2, point, best, best_index, current_max);
+      candidate = best_index;
+      if (best > current_max)
+        Kokkos::atomic_max(&_max(), best);
+
+      if (leaf == begin &&
+          maxDistanceToBox(_points2(candidate),
+                           chunkBoundingBox(_bvh1, begin, end)) <=
+              Kokkos::atomic_load(&_max()))
+        return;
+    }
+  }
+};
+
+// Chamfer distance: the sum of the nearest neighbor distances, each search
+// being seeded with the nearest neighbor of the previous point of the chunk
+template <class BVH1, class BVH2, class Points2, class Distance>
+struct ChamferSearch
+{
+  BVH1 _bvh1;
+  BVH2 _bvh2;
+  Points2 _points2;
+
+  KOKKOS_FUNCTION void operator()(int chunk, Distance &sum) const
+  {
+    auto const range = chunkRange(_bvh1, chunk);
+    int const begin = range.first;
+    int const end = range.second;
+    int candidate = -1;
+    for (int leaf = begin; leaf < end; ++leaf)
+    {
+      auto const &point = HappyTreeFriends::getIndexable(_bvh1, leaf);
+      auto best = KokkosExt::ArithmeticTraits::infinity<Distance>::value;
+      int best_index = -1;
+      if (candidate >= 0)
+      {
+        best = Details::distance(point, _points2(candidate));
+        best_index = candidate;
+      }
+      updateNearest(_bvh2, point, best, best_index, Distance(0));
+      candidate = best_index;
+      sum += best;
+    }
+  }
+};
+
+template <class ExecutionSpace, class Points>
+auto buildPointSetTree(ExecutionSpace const &space, Points const &points)
+{
+  using Access = AccessValues<Points>;
+  static_assert(
+      KokkosExt::is_accessible_from<typename Access::memory_space,
+                                    ExecutionSpace>::value,
+      "Points must be accessible from the execution space");
+  static_assert(GeometryTraits::is_point_v<typename Access::value_type>);
+  return BoundingVolumeHierarchy(
+      space, Experimental::attach_indices(Access{points}));
+}
+
+template <class BVH>
+using PointSetDistance = decltype(Details::distance(
+    std::declval<typename BVH::bounding_volume_type>().minCorner(),
+    std::declval<typename BVH::bounding_volume_type>().minCorner()));
+
+template <class ExecutionSpace, class BVH1, class Points2, class BVH2,
+          class Best>
+void directedHausdorff(ExecutionSpace const &space, BVH1 const &bvh1,
+                       Points2 const &points2, BVH2 const &bvh2,
+                       Best const &max)
+{
+  Kokkos::parallel_for(
+      "ArborX::Experimental::DirectedHausdorffDistance::search",
+      Kokkos::RangePolicy(space, 0, numChunks(bvh1)),
+      DirectedHausdorffSearch<BVH1, BVH2, AccessValues<Points2>, Best>{
+          bvh1, bvh2, AccessValues<Points2>{points2}, max});
+}
+
+} // namespace ArborX::Details
+
+namespace ArborX::Experimental
+{
+
+template <typename Distance>
+struct ClosestPair
+{
+  int first;
+  int second;
+  Distance distance;
+};
+
+// Closest pair between two point sets, given as the indices of the points
+// in the first and second sets, and their distance
+template <class ExecutionSpace, class Points1, class Points2>
+auto closestPair(ExecutionSpace const &space, Points1 const &points1,
+                 Points2 const &points2)
+{
+  Kokkos::Profiling::ScopedRegion guard("ArborX::Experimental::ClosestPair");
+
+  auto const bvh1 = Details::buildPointSetTree(space, points1);
+  auto const bvh2 = Details::buildPointSetTree(space, points2);
+  ARBORX_ASSERT(!bvh1.empty() && !bvh2.empty());
+
+  using BVH1 = std::decay_t<decltype(bvh1)>;
+  using BVH2 = std::decay_t<decltype(bvh2)>;
+  using MemorySpace = typename BVH1::memory_space;
+  using Distance = Details::PointSetDistance<BVH1>;
+
+  int const num_chunks = Details::numChunks(bvh1);
+  Kokkos::View<Distance, MemorySpace> best(
+      "ArborX::Experimental::ClosestPair::best");
+  Kokkos::deep_copy(
+      space, best,
+      Details::KokkosExt::ArithmeticTraits::infinity<Distance>::value);
+  Kokkos::View<Distance *, MemorySpace> chunk_best(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                         "ArborX::Experimental::ClosestPair::chunk_best"),
+      num_chunks);
+  Kokkos::View<Kokkos::pair<int, int> *, MemorySpace> chunk_pairs(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                         "ArborX::Experimental::ClosestPair::chunk_pairs"),
+      num_chunks);
+  Kokkos::parallel_for(
+      "ArborX::Experimental::ClosestPair::search",
+      Kokkos::RangePolicy(space, 0, num_chunks),
+      Details::ClosestPairSearch<BVH1, BVH2, decltype(best),
+                                 decltype(chunk_best), decltype(chunk_pairs)>{
+          bvh1, bvh2, best, chunk_best, chunk_pairs});
+
+  using MinLoc = Kokkos::MinLoc<Distance, int>;
+  typename MinLoc::value_type result;
+  Kokkos::parallel_reduce(
+      "ArborX::Experimental::ClosestPair::reduce",
+      Kokkos::RangePolicy(space, 0, num_chunks),
+      KOKKOS_LAMBDA(int chunk, typename MinLoc::value_type &update) {
+        if (chunk_best(chunk) < update.val)
+        {
+          update.val = chunk_best(chunk);
+          update.loc = chunk;
+        }
+      },
+      MinLoc(result));
+
+  auto const pair = Kokkos::create_mirror_view_and_copy(
+      Kokkos::HostSpace{}, Kokkos::subview(chunk_pairs, result.loc));
+  return ClosestPair<Distance>{pair().first, pair().second, result.val};
+}
+
+// Directed Hausdorff distance from the first point set to the second one,
+// i.e. the largest distance from a point of the first set to the second set
+template <class ExecutionSpace, class Points1, class Points2>
+auto directedHausdorffDistance(ExecutionSpace const &space,
+                               Points1 const &points1, Points2 const &points2)
+{
+  Kokkos::Profiling::ScopedRegion guard(
+      "ArborX::Experimental::DirectedHausdorffDistance");
+
+  auto const bvh1 = Details::buildPointSetTree(space, points1);
+  auto const bvh2 = Details::buildPointSetTree(space, points2);
+  ARBORX_ASSERT(!bvh2.empty());
+
+  using BVH1 = std::decay_t<decltype(bvh1)>;
+  using MemorySpace = typename BVH1::memory_space;
+  using Distance = Details::PointSetDistance<BVH1>;
+
+  Kokkos::View<Distance, MemorySpace> max(
+      "ArborX::Experimental::DirectedHausdorffDistance::max");
+  Details::directedHausdorff(space, bvh1, points2, bvh2, max);
+
+  Distance result;
+  Kokkos::deep_copy(result, max);
+  return result;
+}
+
+// Symmetric Hausdorff distance between two point sets. Both directions share
+// the global best-so-far maximum.
+template <class ExecutionSpace, class Points1, class Points2>
+auto hausdorffDistance(ExecutionSpace const &space, Points1 const &points1,
+                       Points2 const &points2)
+{
+  Kokkos::Profiling::ScopedRegion guard(
+      "ArborX::Experimental::HausdorffDistance");
+
+  auto const bvh1 = Details::buildPointSetTree(space, points1);
+  auto const bvh2 = Details::buildPointSetTree(space, points2);
+  ARBORX_ASSERT(!bvh1.empty() && !bvh2.empty());
+
+  using BVH1 = std::decay_t<decltype(bvh1)>;
+  using MemorySpace = typename BVH1::memory_space;
+  using Distance = Details::PointSetDistance<BVH1>;
+
+  Kokkos::View<Distance, MemorySpace> max(
+      "ArborX::Experimental::HausdorffDistance::max");
+  Details::directedHausdorff(space, bvh1, points2, bvh2, max);
+  Details::directedHausdorff(space, bvh2, points1, bvh1, max);
+
+  Distance result;
+  Kokkos::deep_copy(result, max);
+  return result;
+}
+
+// Chamfer distance between two point sets: the average distance from the
+// points of the first set to the second set plus the average distance from
+// the points of the second set to the first set
+template <class ExecutionSpace, class Points1, class Points2>
+auto chamferDistance(ExecutionSpace const &space, Points1 const &points1,
+                     Points2 const &points2)
+{
+  Kokkos::Profiling::ScopedRegion guard(
+      "ArborX::Experimental::ChamferDistance");
+
+  auto const bvh1 = Details::buildPointSetTree(space, points1);
+  auto const bvh2 = Details::buildPointSetTree(space, points2);
+  ARBORX_ASSERT(!bvh1.empty() && !bvh2.empty());
+
+  using BVH1 = std::decay_t<decltype(bvh1)>;
+  using BVH2 = std::decay_t<decltype(bvh2)>;
+  using Distance = Details::PointSetDistance<BVH1>;
+  using Access1 = Details::AccessValues<Points1>;
+  using Access2 = Details::AccessValues<Points2>;
+
+  Distance sum12 = 0;
+  Kokkos::parallel_reduce(
+      "ArborX::Experimental::ChamferDistance::search",
+      Kokkos::RangePolicy(space, 0, Details::numChunks(bvh1)),
+      Details::ChamferSearch<BVH1, BVH2, Access2, Distance>{
+          bvh1, bvh2, Access2{points2}},
+      sum12);
+  Distance sum21 = 0;
+  Kokkos::parallel_reduce(
+      "ArborX::Experimental::ChamferDistance::search",
+      Kokkos::RangePolicy(space, 0, Details::numChunks(bvh2)),
+      Details::ChamferSearch<BVH2, BVH1, Access1, Distance>{
+          bvh2, bvh1, Access1{points1}},
+      sum21);
+
+  return sum12 / bvh1.size() + sum21 / bvh2.size();
+}
+
+template <typename Distance>
+struct FarthestPair
+{
+  int first;
+  int second;
+  Distance distance;
+};
+
+// Approximate diameter of a point set by double sweeps of farthest neighbor
+// queries: from evenly spaced starting points, find the farthest point, then
+// the point farthest from it. The farthest pair found is returned. Its
+// distance is never larger than the diameter, and at least half of it (by
+// the triangle inequality); it is usually exact or very close.
+template <class ExecutionSpace, class Points>
+auto approximateDiameter(ExecutionSpace const &space, Points const &points,
+                         int num_starts = 32)
+{
+  Kokkos::Profiling::ScopedRegion guard(
+      "ArborX::Experimental::ApproximateDiameter");
+
+  auto const bvh = Details::buildPointSetTree(space, points);
+  ARBORX_ASSERT(!bvh.empty());
+  ARBORX_ASSERT(num_starts > 0);
+
+  using BVH = std::decay_t<decltype(bvh)>;
+  using MemorySpace = typename BVH::memory_space;
+  using Distance = Details::PointSetDistance<BVH>;
+  using Access = Details::AccessValues<Points>;
+  using Point = typename Access::value_type;
+  using Predicate = decltype(farthest(std::declval<Point>()));
+
+  Access access{points}; // NOLINT
+  int const n = access.size();
+  int const m = Kokkos::min(num_starts, n);
+
+  Kokkos::View<int *, MemorySpace> starts(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                         "ArborX::Experimental::ApproximateDiameter::starts"),
+      m);
+  Kokkos::View<Predicate *, MemorySpace> queries(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                         "ArborX::Experimental::ApproximateDiameter::queries"),
+      m);
+  Kokkos::parallel_for(
+      "ArborX::Experimental::ApproximateDiameter::first_sweep",
+      Kokkos::RangePolicy(space, 0, m), KOKKOS_LAMBDA(int i) {
+        starts(i) = static_cast<int>(static_cast<long long>(i) * n / m);
+        queries(i) = farthest(access(starts(i)));
+      });
+
+  Kokkos::View<typename BVH::value_type *, MemorySpace> ends(
+      "ArborX::Experimental::ApproximateDiameter::ends", 0);
+  Kokkos::View<int *, MemorySpace> offsets(
+      "ArborX::Experimental::ApproximateDiameter::offsets", 0);
+  bvh.query(space, queries, ends, offsets);
+
+  Kokkos::parallel_for(
+      "ArborX::Experimental::ApproximateDiameter::second_sweep",
+      Kokkos::RangePolicy(space, 0, m), KOKKOS_LAMBDA(int i) {
+        starts(i) = ends(i).index;
+        queries(i) = farthest(ends(i).value);
+      });
+  bvh.query(space, queries, ends, offsets);
+
+  using MaxLoc = Kokkos::MaxLoc<Distance, int>;
+  typename MaxLoc::value_type result;
+  Kokkos::parallel_reduce(
+      "ArborX::Experimental::ApproximateDiameter::reduce",
+      Kokkos::RangePolicy(space, 0, m),
+      KOKKOS_LAMBDA(int i, typename MaxLoc::value_type &update) {
+        auto const d = Details::distance(access(starts(i)), ends(i).value);
+        if (d > update.val)
+        {
+          update.val = d;
+          update.loc = i;
+        }
+      },
+      MaxLoc(result));
+
+  auto const first = Kokkos::create_mirror_view_and_copy(
+      Kokkos::HostSpace{}, Kokkos::subview(starts, result.loc));
+  auto const second = Kokkos::create_mirror_view_and_copy(
+      Kokkos::HostSpace{}, Kokkos::subview(ends, result.loc));
+  return FarthestPair<Distance>{first(), static_cast<int>(second().index),
+                                result.val};
+}
+
+} // namespace ArborX::Experimental
+
+#endif
@@ -61,7 +61,7 @@ public:
   {}
 };
 
-template <class UserPrimitives>
+template <class UserPrimitives, class Metric = Euclidean>
 class PrimitivesNearestK
 {
   using Primitives = Details::AccessValues<UserPrimitives>;
@@ -72,6 +72,7 @@ class PrimitivesNearestK
 public:
   Primitives _primitives;
   int _k;
+  Metric _metric = {};
 };
 
 template <typename Primitives>
@@ -102,6 +103,20 @@ auto make_nearest(Primitives const &primitives, int k)
   return PrimitivesNearestK<Primitives>{primitives, k};
 }
 
+template <typename Primitives, typename Metric>
+auto make_nearest(Primitives const &primitives, int k, Metric const &metric)
+{
+  Details::check_valid_access_traits(primitives);
+  return PrimitivesNearestK<Primitives, Metric>{primitives, k, metric};
+}
+
+template <typename Primitives>
+auto make_farthest(Primitives const &primitives, int k)
+{
+  Details::check_valid_access_traits(primitives);
+  return PrimitivesNearestK<Primitives, Farthest>{primitives, k};
+}
+
 } // namespace Experimental
 
 template <class Primitives>
@@ -169,11 +184,11 @@ public:
   }
 };
 
-template <class Primitives>
-struct AccessTraits<Experimental::PrimitivesNearestK<Primitives>>
+template <class Primitives, class Metric>
+struct AccessTraits<Experimental::PrimitivesNearestK<Primitives, Metric>>
 {
 private:
-  using Self = Experimental::PrimitivesNearestK<Primitives>;
+  using Self = Experimental::PrimitivesNearestK<Primitives, Metric>;
 
 public:
   using memory_space = typename Primitives::memory_space;
@@ -185,7 +200,7 @@ public:
   }
   static KOKKOS_FUNCTION auto get(Self const &x, size_type i)
   {
-    return nearest(x._primitives(i), x._k);
+    return nearest(x._primitives(i), x._k, x._metric);
   }
 };
 
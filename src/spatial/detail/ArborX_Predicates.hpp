@@ -11,9 +11,13 @@
 #ifndef ARBORX_PREDICATE_HPP
 #define ARBORX_PREDICATE_HPP
 
+#include <ArborX_Metrics.hpp>
+#include <ArborX_SpatioTemporal.hpp>
+#include <algorithms/ArborX_Contains.hpp>
 #include <algorithms/ArborX_Distance.hpp>
 #include <algorithms/ArborX_Intersects.hpp>
 
+#include <Kokkos_DetectionIdiom.hpp>
 #include <Kokkos_Macros.hpp>
 
 #include <type_traits>
@@ -40,7 +44,7 @@ struct is_valid_predicate_tag
 };
 } // namespace Details
 
-template <typename Geometry>
+template <typename Geometry, typename Metric = Experimental::Euclidean>
 struct Nearest
 {
   using Tag = Details::NearestPredicateTag;
@@ -54,15 +58,22 @@ struct Nearest
       , _k(k)
   {}
 
+  KOKKOS_FUNCTION
+  Nearest(Geometry const &geometry, int k, Metric const &metric)
+      : _geometry(geometry)
+      , _k(k)
+      , _metric(metric)
+  {}
+
   template <class OtherGeometry>
   KOKKOS_FUNCTION auto distance(OtherGeometry const &other) const
   {
-    using Details::distance;
-    return distance(_geometry, other);
+    return _metric.distance(_geometry, other);
   }
 
   Geometry _geometry;
   int _k = 0;
+  Metric _metric;
 };
 
 template <typename Geometry>
@@ -110,8 +121,111 @@ struct OrderedSpatial
 
   Geometry _geometry;
 };
+
+// Select the values lying entirely inside the region. The bounding volume of
+// an internal node only needs to intersect the region for the subtree to hold
+// some of these values, and when it lies inside the region the whole subtree
+// is reported without testing the leaves.
+template <typename Geometry>
+struct Within
+{
+  using Tag = Details::SpatialPredicateTag;
+
+  KOKKOS_DEFAULTED_FUNCTION Within() = default;
+
+  KOKKOS_FUNCTION Within(Geometry const &geometry)
+      : _geometry(geometry)
+  {}
+
+  template <typename OtherGeometry>
+  KOKKOS_FUNCTION bool operator()(OtherGeometry const &other) const
+  {
+    return Details::contains(_geometry, other);
+  }
+
+  template <typename BoundingVolume>
+  KOKKOS_FUNCTION bool
+  overlapsSubtree(BoundingVolume const &bounding_volume) const
+  {
+    return Details::intersects(_geometry, bounding_volume);
+  }
+
+  template <typename BoundingVolume>
+  KOKKOS_FUNCTION bool
+  acceptsSubtree(BoundingVolume const &bounding_volume) const
+  {
+    return Details::contains(_geometry, bounding_volume);
+  }
+
+  Geometry _geometry;
+};
+
+// Select the values containing the geometry (e.g. the boxes containing a
+// point). Containment carries over to the enclosing bounding volumes, so the
+// same test prunes the internal nodes.
+template <typename Geometry>
+struct Contains
+{
+  using Tag = Details::SpatialPredicateTag;
+
+  KOKKOS_DEFAULTED_FUNCTION Contains() = default;
+
+  KOKKOS_FUNCTION Contains(Geometry const &geometry)
+      : _geometry(geometry)
+  {}
+
+  template <typename OtherGeometry>
+  KOKKOS_FUNCTION bool operator()(OtherGeometry const &other) const
+  {
+    return Details::contains(other, _geometry);
+  }
+
+  Geometry _geometry;
+};
 } // namespace Experimental
 
+namespace Details
+{
+template <typename Predicate, typename BoundingVolume>
+using PredicateOverlapsSubtreeArchetypeExpression =
+    decltype(std::declval<Predicate const &>().overlapsSubtree(
+        std::declval<BoundingVolume const &>()));
+
+template <typename Predicate, typename BoundingVolume>
+using PredicateAcceptsSubtreeArchetypeExpression =
+    decltype(std::declval<Predicate const &>().acceptsSubtree(
+        std::declval<BoundingVolume const &>()));
+
+// Check whether the subtree of an internal node with the given bounding volume
+// may hold values satisfying a spatial predicate. Unless the predicate says
+// otherwise, this is the same test as for the leaves.
+template <typename Predicate, typename BoundingVolume>
+KOKKOS_INLINE_FUNCTION bool
+overlapsSubtree(Predicate const &predicate,
+                BoundingVolume const &bounding_volume)
+{
+  if constexpr (Kokkos::is_detected<PredicateOverlapsSubtreeArchetypeExpression,
+                                    Predicate, BoundingVolume>{})
+    return predicate.overlapsSubtree(bounding_volume);
+  else
+    return predicate(bounding_volume);
+}
+
+// Check whether all the values in the subtree of an internal node with the
+// given bounding volume satisfy a spatial predicate
+template <typename Predicate, typename BoundingVolume>
+KOKKOS_INLINE_FUNCTION bool
+acceptsSubtree(Predicate const &predicate,
+               BoundingVolume const &bounding_volume)
+{
+  if constexpr (Kokkos::is_detected<PredicateAcceptsSubtreeArchetypeExpression,
+                                    Predicate, BoundingVolume>{})
+    return predicate.acceptsSubtree(bounding_volume);
+  else
+    return false;
+}
+} // namespace Details
+
 template <typename Geometry>
 KOKKOS_INLINE_FUNCTION Nearest<Geometry> nearest(Geometry const &geometry,
                                                  int k = 1)
@@ -119,18 +233,32 @@ KOKKOS_INLINE_FUNCTION Nearest<Geometry> nearest(Geometry const &geometry,
   return Nearest<Geometry>(geometry, k);
 }
 
+template <typename Geometry, typename Metric>
+KOKKOS_INLINE_FUNCTION Nearest<Geometry, Metric>
+nearest(Geometry const &geometry, int k, Metric const &metric)
+{
+  return Nearest<Geometry, Metric>(geometry, k, metric);
+}
+
 template <typename Geometry>
 KOKKOS_INLINE_FUNCTION Intersects<Geometry> intersects(Geometry const &geometry)
 {
   return Intersects<Geometry>(geometry);
 }
 
-template <typename Geometry>
-KOKKOS_INLINE_FUNCTION int getK(Nearest<Geometry> const &pred)
+template <typename Geometry, typename Metric>
+KOKKOS_INLINE_FUNCTION int getK(Nearest<Geometry, Metric> const &pred)
 {
   return pred._k;
 }
 
+template <typename Geometry, typename Metric>
+KOKKOS_INLINE_FUNCTION Metric const &
+getMetric(Nearest<Geometry, Metric> const &pred)
+{
+  return pred._metric;
+}
+
 namespace Experimental
 {
 template <typename Geometry>
@@ -139,16 +267,49 @@ ordered_intersects(Geometry const &geometry)
 {
   return OrderedSpatial<Geometry>(geometry);
 }
-} // namespace Experimental
+
+// Select the spatio-temporal data (points or boxes whose last coordinate is
+// the time) that intersect the geometry at some time in [t_begin, t_end]
+template <typename Geometry, typename Coordinate>
+KOKKOS_INLINE_FUNCTION Intersects<SpatioTemporal<Geometry>>
+intersects_during(Geometry const &geometry, Coordinate t_begin,
+                  Coordinate t_end)
+{
+  return Intersects<SpatioTemporal<Geometry>>(
+      SpatioTemporal<Geometry>(geometry, t_begin, t_end));
+}
 
 template <typename Geometry>
+KOKKOS_INLINE_FUNCTION Within<Geometry> within(Geometry const &region)
+{
+  return Within<Geometry>(region);
+}
+
+template <typename Geometry>
+KOKKOS_INLINE_FUNCTION Contains<Geometry> contains(Geometry const &geometry)
+{
+  return Contains<Geometry>(geometry);
+}
+
+// Select the k values farthest from the geometry, sorted by decreasing
+// distance. This is a nearest predicate for the reversed order of the
+// Farthest metric.
+template <typename Geometry>
+KOKKOS_INLINE_FUNCTION Nearest<Geometry, Farthest>
+farthest(Geometry const &geometry, int k = 1)
+{
+  return Nearest<Geometry, Farthest>(geometry, k);
+}
+} // namespace Experimental
+
+template <typename Geometry, typename Metric>
 KOKKOS_INLINE_FUNCTION Geometry const &
-getGeometry(Nearest<Geometry> const &pred)
+getGeometry(Nearest<Geometry, Metric> const &pred)
 {
   return pred._geometry;
 }
-template <typename Geometry>
-KOKKOS_INLINE_FUNCTION Geometry getGeometry(Nearest<Geometry> &&pred)
+template <typename Geometry, typename Metric>
+KOKKOS_INLINE_FUNCTION Geometry getGeometry(Nearest<Geometry, Metric> &&pred)
 {
   return pred._geometry;
 }
@@ -178,6 +339,20 @@ getGeometry(Experimental::OrderedSpatial<Geometry> &&pred)
   return pred._geometry;
 }
 
+template <typename Geometry>
+KOKKOS_INLINE_FUNCTION Geometry const &
+getGeometry(Experimental::Within<Geometry> const &pred)
+{
+  return pred._geometry;
+}
+
+template <typename Geometry>
+KOKKOS_INLINE_FUNCTION Geometry const &
+getGeometry(Experimental::Contains<Geometry> const &pred)
+{
+  return pred._geometry;
+}
+
 template <typename Predicate, typename Data>
 struct PredicateWithAttachment : Predicate
 {
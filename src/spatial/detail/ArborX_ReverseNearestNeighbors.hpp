@@ -0,0 +1,181 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#ifndef ARBORX_REVERSE_NEAREST_NEIGHBORS_HPP
+#define ARBORX_REVERSE_NEAREST_NEIGHBORS_HPP
+
+#include <ArborX_GeometryTraits.hpp>
+#include <ArborX_LinearBVH.hpp>
+#include <ArborX_Point.hpp>
+#include <ArborX_Sphere.hpp>
+#include <algorithms/ArborX_Convert.hpp>
+#include <algorithms/ArborX_Distance.hpp>
+#include <detail/ArborX_AccessTraits.hpp>
+#include <detail/ArborX_NeighborList.hpp>
+#include <detail/ArborX_PredicateHelpers.hpp>
+#include <kokkos_ext/ArborX_KokkosExtArithmeticTraits.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Profiling_ScopedRegion.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace ArborX::Details
+{
+struct ReverseNearestNeighborsCallback
+{
+  template <typename Predicate, typename Value, typename Index,
+            typename Output>
+  KOKKOS_FUNCTION void operator()(Predicate const &,
+                                  PairValueIndex<Value, Index> const &value,
+                                  Output const &out) const
+  {
+    out(value.index);
+  }
+};
+} // namespace ArborX::Details
+
+namespace ArborX::Experimental
+{
+
+// Reverse k-nearest neighbors search. For a query point q, find the data
+// points p that have q among their k nearest neighbors, i.e. such that
+// d(p, q) <= d_k(p) with d_k(p) the distance from p to its k-th nearest data
+// point.
+//
+// The k-th distances are computed once, at construction, and each data point
+// is indexed as the ball of radius d_k(p) around it. The bounding volume of
+// an internal node therefore bounds the k-th distances of its subtree, and
+// the subtrees that are too far from the query to hold reverse neighbors are
+// pruned. If there are no more than k data points, all of them are reverse
+// neighbors of any query.
+template <typename MemorySpace, typename Point>
+class ReverseNearestNeighbors
+{
+  static constexpr int dimension = GeometryTraits::dimension_v<Point>;
+  using Coordinate = GeometryTraits::coordinate_type_t<Point>;
+  using Ball = Sphere<dimension, Coordinate>;
+
+public:
+  using memory_space = MemorySpace;
+
+  ReverseNearestNeighbors() = default;
+
+  template <typename ExecutionSpace, typename Points>
+  ReverseNearestNeighbors(ExecutionSpace const &space, Points const &points,
+                          int k)
+  {
+    Kokkos::Profiling::ScopedRegion guard(
+        "ArborX::ReverseNearestNeighbors::ReverseNearestNeighbors");
+
+    namespace KokkosExt = ArborX::Details::KokkosExt;
+
+    static_assert(
+        KokkosExt::is_accessible_from<MemorySpace, ExecutionSpace>::value,
+        "Memory space must be accessible from the execution space");
+
+    Details::check_valid_access_traits(points);
+    using Access = Details::AccessValues<Points>;
+    static_assert(
+        KokkosExt::is_accessible_from<typename Access::memory_space,
+                                      ExecutionSpace>::value,
+        "Points must be accessible from the execution space");
+    static_assert(std::is_same_v<typename Access::value_type, Point>);
+    static_assert(GeometryTraits::is_point_v<Point>);
+
+    KOKKOS_ASSERT(k > 0);
+
+    Access access{points}; // NOLINT
+
+    using Distance = decltype(Details::distance(std::declval<Point>(),
+                                                std::declval<Point>()));
+    Kokkos::View<int *, MemorySpace> offsets(
+        "ArborX::ReverseNearestNeighbors::offsets", 0);
+    Kokkos::View<int *, MemorySpace> indices(
+        "ArborX::ReverseNearestNeighbors::indices", 0);
+    Kokkos::View<Distance *, MemorySpace> distances(
+        "ArborX::ReverseNearestNeighbors::distances", 0);
+    findKNearestNeighborGraph(space, points, k, offsets, indices, distances);
+
+    _tree = Tree(space, attach_indices(makeBalls(space, access, k, distances)));
+  }
+
+  KOKKOS_FUNCTION auto size() const noexcept { return _tree.size(); }
+
+  KOKKOS_FUNCTION bool empty() const noexcept { return _tree.empty(); }
+
+  // Find the reverse neighbors of each query point, stored in
+  // indices(offsets(q):offsets(q+1))
+  template <typename ExecutionSpace, typename QueryPoints, typename Indices,
+            typename Offsets>
+  void query(ExecutionSpace const &space, QueryPoints const &query_points,
+             Indices &indices, Offsets &offsets) const
+  {
+    Kokkos::Profiling::ScopedRegion guard(
+        "ArborX::ReverseNearestNeighbors::query");
+
+    _tree.query(space, make_intersects(query_points),
+                Details::ReverseNearestNeighborsCallback{}, indices, offsets);
+  }
+
+  // enclosing function for an extended __host__ __device__ lambda cannot have
+  // private or protected access within its class
+#ifndef KOKKOS_COMPILER_NVCC
+private:
+#endif
+  // Balls of radius the k-th neighbor distance around each data point
+  template <typename ExecutionSpace, typename Access, typename Distances>
+  auto makeBalls(ExecutionSpace const &space, Access const &access, int k,
+                 Distances const &distances) const
+  {
+    namespace KokkosExt = ArborX::Details::KokkosExt;
+
+    int const n = access.size();
+    Kokkos::View<Ball *, MemorySpace> balls(
+        Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                           "ArborX::ReverseNearestNeighbors::balls"),
+        n);
+    // Without enough data points, the radius is the largest finite value
+    // rather than infinity to keep the bounds of the hierarchy finite
+    bool const has_k_neighbors = (k < n);
+    auto const max_radius =
+        KokkosExt::ArithmeticTraits::finite_max<Coordinate>::value;
+    Kokkos::parallel_for(
+        "ArborX::ReverseNearestNeighbors::k_distances",
+        Kokkos::RangePolicy(space, 0, n), KOKKOS_LAMBDA(int i) {
+          using ::ArborX::Details::convert;
+          auto const radius =
+              (has_k_neighbors
+                   ? static_cast<Coordinate>(distances(i * k + k - 1))
+                   : max_radius);
+          balls(i) = Ball{
+              convert<::ArborX::Point<dimension, Coordinate>>(access(i)),
+              radius};
+        });
+
+    return balls;
+  }
+
+private:
+  using Tree = BoundingVolumeHierarchy<MemorySpace, PairValueIndex<Ball>>;
+  Tree _tree;
+};
+
+template <typename ExecutionSpace, typename Points>
+ReverseNearestNeighbors(ExecutionSpace, Points, int)
+    -> ReverseNearestNeighbors<
+        typename Details::AccessValues<Points>::memory_space,
+        typename Details::AccessValues<Points>::value_type>;
+
+} // namespace ArborX::Experimental
+
+#endif
@@ -13,6 +13,8 @@
 #define ARBORX_SPACE_FILLING_CURVES_HPP
 
 #include <ArborX_GeometryTraits.hpp>
+#include <ArborX_Point.hpp>
+#include <ArborX_SpatioTemporal.hpp>
 #include <algorithms/ArborX_Centroid.hpp>
 #include <algorithms/ArborX_TranslateAndScale.hpp>
 #include <detail/ArborX_MortonCode.hpp>
@@ -20,11 +22,34 @@
 
 #include <Kokkos_DetectionIdiom.hpp>
 #include <Kokkos_Macros.hpp>
+#include <Kokkos_MinMax.hpp>
 
 #include <type_traits>
 
 namespace ArborX
 {
+namespace Details
+{
+
+// Centroid of the geometry mapped into the unit cube by the scene bounding
+// box. The result is stored in the computation type, since half precision
+// would not retain the resolution of the codes.
+template <typename Box, typename Geometry>
+KOKKOS_FUNCTION auto normalizedCentroid(Box const &scene_bounding_box,
+                                        Geometry const &geometry)
+{
+  static_assert(GeometryTraits::is_box_v<Box>);
+  auto const centroid = returnCentroid(geometry);
+  using Centroid = std::decay_t<decltype(centroid)>;
+  using Coordinate = GeometryTraits::computation_type_t<
+      GeometryTraits::coordinate_type_t<Centroid>>;
+  ::ArborX::Point<GeometryTraits::dimension_v<Centroid>, Coordinate> p;
+  translateAndScale(centroid, p, scene_bounding_box);
+  return p;
+}
+
+} // namespace Details
+
 namespace Experimental
 {
 
@@ -34,25 +59,58 @@ struct Morton32
   KOKKOS_FUNCTION auto operator()(Box const &scene_bounding_box,
                                   Geometry const &geometry) const
   {
-    static_assert(GeometryTraits::is_box_v<Box>);
-    using Details::returnCentroid;
-    auto p = returnCentroid(geometry);
-    Details::translateAndScale(p, p, scene_bounding_box);
-    return Details::morton32(p);
+    return Details::morton32(
+        Details::normalizedCentroid(scene_bounding_box, geometry));
   }
 };
 
 struct Morton64
 {
+  template <typename Box, typename Geometry>
+  KOKKOS_FUNCTION auto operator()(Box const &scene_bounding_box,
+                                  Geometry const &geometry) const
+  {
+    return Details::morton64(
+        Details::normalizedCentroid(scene_bounding_box, geometry));
+  }
+};
+
+// Space-filling curve for spatio-temporal data, where the last coordinate is
+// the time. The time axis is split first: the TIME_BITS most significant bits
+// of the code are the time bin, and the remaining bits are the Morton code of
+// the spatial coordinates. Objects that are close in space but far apart in
+// time are thus never grouped together, which a Morton code on the full
+// coordinates would do for any choice of the time scale.
+template <int TIME_BITS = 16>
+struct TimeMajorMorton64
+{
+  static_assert(TIME_BITS > 0 && TIME_BITS < 64);
+
   template <typename Box, typename Geometry>
   KOKKOS_FUNCTION auto operator()(Box const &scene_bounding_box,
                                   Geometry const &geometry) const
   {
     static_assert(GeometryTraits::is_box_v<Box>);
-    using Details::returnCentroid;
-    auto p = returnCentroid(geometry);
-    Details::translateAndScale(p, p, scene_bounding_box);
-    return Details::morton64(p);
+    constexpr int DIM = GeometryTraits::dimension_v<Box> - 1;
+    static_assert(DIM > 0, "Spatio-temporal data needs at least one spatial "
+                           "dimension in addition to the time");
+
+    auto const p = Details::normalizedCentroid(scene_bounding_box, geometry);
+
+    constexpr unsigned long long num_time_bins = 1llu << TIME_BITS;
+    auto const t =
+        Kokkos::min(Kokkos::max((float)p[DIM] * num_time_bins, 0.f),
+                    (float)num_time_bins - 1);
+
+    // Number of bits used by the Morton code of the spatial coordinates
+    constexpr int spatial_bits = (DIM == 2 ? 62 : (63 / DIM) * DIM);
+    constexpr int available_bits = 64 - TIME_BITS;
+    constexpr int shift =
+        (spatial_bits > available_bits ? spatial_bits - available_bits : 0);
+    auto const spatial_code = Details::morton64(Details::spatialPart(p));
+
+    return ((unsigned long long)t << available_bits) |
+           (spatial_code >> shift);
   }
 };
 
@@ -0,0 +1,407 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#ifndef ARBORX_TETRAHEDRAL_MESH_POINT_LOCATION_HPP
+#define ARBORX_TETRAHEDRAL_MESH_POINT_LOCATION_HPP
+
+#include <ArborX_LinearBVH.hpp>
+#include <ArborX_Point.hpp>
+#include <ArborX_Tetrahedron.hpp>
+#include <detail/ArborX_AccessTraits.hpp>
+#include <detail/ArborX_AttachIndices.hpp>
+#include <detail/ArborX_Callbacks.hpp>
+#include <detail/ArborX_PairValueIndex.hpp>
+#include <detail/ArborX_PredicateHelpers.hpp>
+#include <detail/ArborX_Predicates.hpp>
+#include <kokkos_ext/ArborX_KokkosExtAccessibilityTraits.hpp>
+#include <kokkos_ext/ArborX_KokkosExtArithmeticTraits.hpp>
+#include <kokkos_ext/ArborX_KokkosExtViewHelpers.hpp>
+#include <misc/ArborX_Exception.hpp>
+#include <misc/ArborX_SortUtils.hpp>
+#include <misc/ArborX_Utils.hpp> // computeOffsetsInOrderedView
+#include <misc/ArborX_Vector.hpp>
+
+#include <Kokkos_Array.hpp>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Profiling_ScopedRegion.hpp>
+#include <Kokkos_Swap.hpp>
+
+namespace ArborX
+{
+namespace Details
+{
+
+// Maximum number of cells visited by a walk before falling back to the tree
+// search
+constexpr int point_location_max_walk_steps = 64;
+
+template <typename Vertices, typename Cells>
+struct TetrahedralMeshCells
+{
+  Vertices _vertices;
+  Cells _cells;
+};
+
+template <typename Vertices, typename Cells>
+KOKKOS_FUNCTION auto meshTetrahedron(Vertices const &vertices,
+                                     Cells const &cells, int c)
+{
+  return ExperimentalHyperGeometry::Tetrahedron{
+      vertices(cells(c, 0)), vertices(cells(c, 1)), vertices(cells(c, 2)),
+      vertices(cells(c, 3))};
+}
+
+// Vertices of the face of the cell c opposite to its vertex f, in increasing
+// order
+template <typename Cells>
+KOKKOS_FUNCTION Kokkos::Array<int, 3> sortedFaceVertices(Cells const &cells,
+                                                         int c, int f)
+{
+  Kokkos::Array<int, 3> v = {cells(c, (f + 1) % 4), cells(c, (f + 2) % 4),
+                             cells(c, (f + 3) % 4)};
+  for (int i = 1; i < 3; ++i)
+    for (int j = i; j > 0 && v[j] < v[j - 1]; --j)
+      Kokkos::kokkos_swap(v[j], v[j - 1]);
+  return v;
+}
+
+// Find the cell across each face of each cell. The face f of a cell is the
+// one opposite to its vertex f. The faces are grouped by sorting them by
+// their two lowest vertices, and matched within a group by their third
+// vertex. Boundary faces have no neighbor (-1).
+template <typename ExecutionSpace, typename Cells, typename Neighbors>
+void computeCellNeighbors(ExecutionSpace const &space, int num_vertices,
+                          Cells const &cells, Neighbors &neighbors)
+{
+  Kokkos::Profiling::ScopedRegion guard(
+      "ArborX::TetrahedralMeshPointLocation::cell_neighbors");
+
+  using MemorySpace = typename Cells::memory_space;
+
+  int const num_cells = cells.extent(0);
+
+  Kokkos::View<unsigned long long *, MemorySpace> face_keys(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                         "ArborX::TetrahedralMeshPointLocation::face_keys"),
+      4 * num_cells);
+  Kokkos::parallel_for(
+      "ArborX::TetrahedralMeshPointLocation::face_keys",
+      Kokkos::RangePolicy(space, 0, 4 * num_cells), KOKKOS_LAMBDA(int i) {
+        auto const v = sortedFaceVertices(cells, i / 4, i % 4);
+        face_keys(i) = (unsigned long long)v[0] * num_vertices + v[1];
+      });
+  auto permute = sortObjects(space, face_keys);
+
+  Kokkos::View<int *, MemorySpace> face_offsets(
+      "ArborX::TetrahedralMeshPointLocation::face_offsets", 0);
+  computeOffsetsInOrderedView(space, face_keys, face_offsets);
+  Kokkos::parallel_for(
+      "ArborX::TetrahedralMeshPointLocation::match_faces",
+      Kokkos::RangePolicy(space, 0, face_offsets.size() - 1),
+      KOKKOS_LAMBDA(int i) {
+        for (int k = face_offsets(i); k < face_offsets(i + 1); ++k)
+        {
+          int const face = permute(k);
+          int const third = sortedFaceVertices(cells, face / 4, face % 4)[2];
+          int neighbor = -1;
+          for (int l = face_offsets(i); l < face_offsets(i + 1); ++l)
+          {
+            int const other = permute(l);
+            if (other != face &&
+                sortedFaceVertices(cells, other / 4, other % 4)[2] == third)
+            {
+              neighbor = other / 4;
+              break;
+            }
+          }
+          neighbors(face / 4, face % 4) = neighbor;
+        }
+      });
+}
+
+template <typename Vertices, typename Cells, typename Neighbors>
+struct TetrahedralMeshLocator
+{
+  using Coordinate =
+      GeometryTraits::coordinate_type_t<typename Vertices::value_type>;
+  using Coordinates = Kokkos::Array<Coordinate, 4>;
+
+  Vertices _vertices;
+  Cells _cells;
+  Neighbors _neighbors;
+
+  // Barycentric coordinates of a point with respect to the vertices of the
+  // cell c, computed as ratios of signed volumes
+  template <typename Point>
+  KOKKOS_FUNCTION Coordinates barycentricCoordinates(Point const &point,
+                                                     int c) const
+  {
+    auto const tet = meshTetrahedron(_vertices, _cells, c);
+    auto const ab = tet.b - tet.a;
+    auto const ac = tet.c - tet.a;
+    auto const ad = tet.d - tet.a;
+    auto const ap = point - tet.a;
+    auto const volume = ab.dot(ac.cross(ad));
+    Coordinates lambda;
+    lambda[0] = (tet.b - point).dot((tet.c - point).cross(tet.d - point));
+    lambda[1] = ap.dot(ac.cross(ad));
+    lambda[2] = ab.dot(ap.cross(ad));
+    lambda[3] = ab.dot(ac.cross(ap));
+    for (int j = 0; j < 4; ++j)
+      lambda[j] /= volume;
+    return lambda;
+  }
+
+  // Walk through the mesh from the cell c towards the point, crossing at
+  // each step the face opposite to the most negative barycentric coordinate.
+  // Return the cell containing the point, or -1 if the walk leaves the mesh
+  // or takes too many steps.
+  template <typename Point>
+  KOKKOS_FUNCTION int walk(Point const &point, int c, Coordinates &lambda) const
+  {
+    constexpr auto tolerance =
+        64 * KokkosExt::ArithmeticTraits::epsilon<Coordinate>::value;
+    for (int step = 0; step < point_location_max_walk_steps && c >= 0; ++step)
+    {
+      lambda = barycentricCoordinates(point, c);
+      int f = 0;
+      for (int j = 1; j < 4; ++j)
+        if (lambda[j] < lambda[f])
+          f = j;
+      if (lambda[f] >= -tolerance)
+        return c;
+      c = _neighbors(c, f);
+    }
+    return -1;
+  }
+};
+
+template <typename Locator, typename Points, typename Cells,
+          typename Barycentric>
+struct PointLocationCallback
+{
+  Locator _locator;
+  Points _points;
+  Cells _cells;
+  Barycentric _barycentric;
+
+  template <typename Predicate, typename Value>
+  KOKKOS_FUNCTION auto operator()(Predicate const &predicate,
+                                  Value const &value) const
+  {
+    int const i = getData(predicate);
+    auto const lambda =
+        _locator.barycentricCoordinates(_points(i), value.index);
+    _cells(i) = value.index;
+    for (int j = 0; j < 4; ++j)
+      _barycentric(i, j) = lambda[j];
+    return CallbackTreeTraversalControl::early_exit;
+  }
+};
+
+template <typename Points, typename Filter>
+struct PointsFiltered
+{
+  Points _points;
+  Filter _filter;
+};
+
+} // namespace Details
+
+template <typename Vertices, typename Cells>
+struct AccessTraits<Details::TetrahedralMeshCells<Vertices, Cells>>
+{
+  using Self = Details::TetrahedralMeshCells<Vertices, Cells>;
+
+  using memory_space = typename Vertices::memory_space;
+
+  static KOKKOS_FUNCTION auto size(Self const &self)
+  {
+    return self._cells.extent(0);
+  }
+  static KOKKOS_FUNCTION auto get(Self const &self, int i)
+  {
+    return Details::meshTetrahedron(self._vertices, self._cells, i);
+  }
+};
+
+template <typename Points, typename Filter>
+struct AccessTraits<Details::PointsFiltered<Points, Filter>>
+{
+  using Self = Details::PointsFiltered<Points, Filter>;
+
+  using memory_space = typename Points::memory_space;
+
+  static KOKKOS_FUNCTION auto size(Self const &self)
+  {
+    return self._filter.extent(0);
+  }
+  static KOKKOS_FUNCTION auto get(Self const &self, int i)
+  {
+    int const index = self._filter(i);
+    return attach(intersects(self._points(index)), index);
+  }
+};
+
+namespace Experimental
+{
+
+// Point location in a tetrahedral mesh. For each point, find the cell
+// containing it and the barycentric coordinates of the point with respect to
+// the vertices of that cell. Points outside of the mesh are assigned the cell
+// -1.
+template <typename MemorySpace, typename Coordinate = float>
+class TetrahedralMeshPointLocation
+{
+  using Vertex = Point<3, Coordinate>;
+  using Vertices = Kokkos::View<Vertex *, MemorySpace>;
+  using Cells = Kokkos::View<int *[4], MemorySpace>;
+  using Neighbors = Kokkos::View<int *[4], MemorySpace>;
+  using BVH = BoundingVolumeHierarchy<
+      MemorySpace,
+      PairValueIndex<ExperimentalHyperGeometry::Tetrahedron<Coordinate>>>;
+  using Locator = Details::TetrahedralMeshLocator<Vertices, Cells, Neighbors>;
+
+public:
+  using memory_space = MemorySpace;
+
+  // The cells are given by the indices of their vertices. Neighboring cells
+  // must share a whole face.
+  template <typename ExecutionSpace>
+  TetrahedralMeshPointLocation(ExecutionSpace const &space,
+                               Vertices const &vertices, Cells const &cells)
+  {
+    Kokkos::Profiling::ScopedRegion guard(
+        "ArborX::TetrahedralMeshPointLocation::TetrahedralMeshPointLocation");
+
+    static_assert(
+        Details::KokkosExt::is_accessible_from<MemorySpace,
+                                               ExecutionSpace>::value,
+        "Memory space must be accessible from the execution space");
+
+    Neighbors neighbors(
+        Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                           "ArborX::TetrahedralMeshPointLocation::neighbors"),
+        cells.extent(0));
+    Details::computeCellNeighbors(space, vertices.size(), cells, neighbors);
+
+    Kokkos::Profiling::pushRegion(
+        "ArborX::TetrahedralMeshPointLocation::construction");
+    _bvh = BVH(space, attach_indices(Details::TetrahedralMeshCells<
+                                     Vertices, Cells>{vertices, cells}));
+    Kokkos::Profiling::popRegion();
+
+    _locator = Locator{vertices, cells, neighbors};
+  }
+
+  // Locate the points with a tree search
+  template <typename ExecutionSpace, typename Points, typename PointCells,
+            typename Barycentric>
+  void locate(ExecutionSpace const &space, Points const &points,
+              PointCells &point_cells, Barycentric &barycentric) const
+  {
+    Kokkos::Profiling::ScopedRegion guard(
+        "ArborX::TetrahedralMeshPointLocation::locate");
+
+    static_assert(Kokkos::is_view_v<Points> && Kokkos::is_view_v<PointCells> &&
+                  Kokkos::is_view_v<Barycentric>);
+    static_assert(GeometryTraits::is_point_v<typename Points::value_type>);
+
+    int const n = points.size();
+    Details::KokkosExt::reallocWithoutInitializing(space, point_cells, n);
+    Details::KokkosExt::reallocWithoutInitializing(space, barycentric, n);
+    Kokkos::deep_copy(space, point_cells, -1);
+
+    _bvh.query(space, attach_indices(make_intersects(points)),
+               Details::PointLocationCallback<Locator, Points, PointCells,
+                                              Barycentric>{
+                   _locator, points, point_cells, barycentric});
+  }
+
+  // Locate the points by walking through the mesh from the guessed cells,
+  // e.g., the cells located at a previous step for slightly moved points.
+  // The guesses may be the same view as the output cells. The points with a
+  // negative guess, or that the walk fails to locate, are located with a tree
+  // search.
+  template <typename ExecutionSpace, typename Points, typename Guesses,
+            typename PointCells, typename Barycentric>
+  void locate(ExecutionSpace const &space, Points const &points,
+              Guesses const &guesses, PointCells &point_cells,
+              Barycentric &barycentric) const
+  {
+    Kokkos::Profiling::ScopedRegion guard(
+        "ArborX::TetrahedralMeshPointLocation::locate");
+
+    static_assert(Kokkos::is_view_v<Points> && Kokkos::is_view_v<Guesses> &&
+                  Kokkos::is_view_v<PointCells> &&
+                  Kokkos::is_view_v<Barycentric>);
+    static_assert(GeometryTraits::is_point_v<typename Points::value_type>);
+
+    int const n = points.size();
+    ARBORX_ASSERT((int)guesses.size() == n);
+    Details::KokkosExt::reallocWithoutInitializing(space, point_cells, n);
+    Details::KokkosExt::reallocWithoutInitializing(space, barycentric, n);
+
+    auto const &locator = _locator;
+    Kokkos::parallel_for(
+        "ArborX::TetrahedralMeshPointLocation::walk",
+        Kokkos::RangePolicy(space, 0, n), KOKKOS_LAMBDA(int i) {
+          typename Locator::Coordinates lambda;
+          int const c = locator.walk(points(i), guesses(i), lambda);
+          point_cells(i) = c;
+          if (c >= 0)
+            for (int j = 0; j < 4; ++j)
+              barycentric(i, j) = lambda[j];
+        });
+
+    Kokkos::View<int *, MemorySpace> lost(
+        Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                           "ArborX::TetrahedralMeshPointLocation::lost"),
+        n);
+    int num_lost;
+    Kokkos::parallel_scan(
+        "ArborX::TetrahedralMeshPointLocation::compact_lost",
+        Kokkos::RangePolicy(space, 0, n),
+        KOKKOS_LAMBDA(int i, int &update, bool final_pass) {
+          if (point_cells(i) >= 0)
+            return;
+          if (final_pass)
+            lost(update) = i;
+          ++update;
+        },
+        num_lost);
+    if (num_lost == 0)
+      return;
+
+    Kokkos::Profiling::pushRegion(
+        "ArborX::TetrahedralMeshPointLocation::fallback");
+    auto const lost_points =
+        Kokkos::subview(lost, Kokkos::make_pair(0, num_lost));
+    _bvh.query(
+        space,
+        Details::PointsFiltered<Points, decltype(lost_points)>{points,
+                                                               lost_points},
+        Details::PointLocationCallback<Locator, Points, PointCells,
+                                       Barycentric>{_locator, points,
+                                                    point_cells, barycentric});
+    Kokkos::Profiling::popRegion();
+  }
+
+private:
+  BVH _bvh;
+  Locator _locator;
+};
+
+} // namespace Experimental
+
+} // namespace ArborX
+
+#endif
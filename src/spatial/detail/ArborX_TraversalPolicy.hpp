@@ -33,6 +33,13 @@ struct TraversalPolicy
   // Sort predicates allows disabling predicate sorting.
   bool _sort_predicates = true;
 
+  // Buffer size estimation picks the buffer size from the number of results
+  // of a sample of the predicates, traversed before the first pass. It is
+  // only used for spatial predicates when no buffer size is provided, and
+  // falls back to the default behavior (second pass) if the guess is too
+  // small.
+  bool _estimate_buffer_size = false;
+
   TraversalPolicy &setBufferSize(int buffer_size)
   {
     _buffer_size = buffer_size;
@@ -44,6 +51,12 @@ struct TraversalPolicy
     _sort_predicates = sort_predicates;
     return *this;
   }
+
+  TraversalPolicy &setBufferSizeEstimation(bool estimate_buffer_size)
+  {
+    _estimate_buffer_size = estimate_buffer_size;
+    return *this;
+  }
 };
 
 } // namespace Experimental
@@ -0,0 +1,116 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#ifndef ARBORX_DETAIL_TREE_QUALITY_HPP
+#define ARBORX_DETAIL_TREE_QUALITY_HPP
+
+#include <ArborX_GeometryTraits.hpp>
+#include <algorithms/ArborX_Expand.hpp>
+#include <algorithms/ArborX_Intersects.hpp>
+#include <detail/ArborX_HappyTreeFriends.hpp>
+#include <detail/ArborX_Node.hpp> // ROPE_SENTINEL
+
+#include <Kokkos_Core.hpp>
+
+namespace ArborX
+{
+namespace Details
+{
+
+// Relative costs of traversing an internal node and of testing a leaf in the
+// surface area heuristic
+constexpr double sah_internal_cost = 1.2;
+constexpr double sah_leaf_cost = 1.;
+
+template <class Box>
+KOKKOS_FUNCTION double boxSurfaceArea(Box const &box)
+{
+  constexpr int DIM = GeometryTraits::dimension_v<Box>;
+  double area = 0;
+  for (int d = 0; d < DIM; ++d)
+  {
+    double face = 1;
+    for (int e = 0; e < DIM; ++e)
+      if (e != d)
+        face *= box.maxCorner()[e] - box.minCorner()[e];
+    area += face;
+  }
+  return 2 * area;
+}
+
+template <class Box>
+KOKKOS_FUNCTION double boxVolume(Box const &box)
+{
+  constexpr int DIM = GeometryTraits::dimension_v<Box>;
+  double volume = 1;
+  for (int d = 0; d < DIM; ++d)
+    volume *= box.maxCorner()[d] - box.minCorner()[d];
+  return volume;
+}
+
+// Intersection of two intersecting boxes
+template <class Box>
+KOKKOS_FUNCTION Box boxIntersection(Box const &a, Box const &b)
+{
+  constexpr int DIM = GeometryTraits::dimension_v<Box>;
+  Box box;
+  for (int d = 0; d < DIM; ++d)
+  {
+    box.minCorner()[d] = Kokkos::max(a.minCorner()[d], b.minCorner()[d]);
+    box.maxCorner()[d] = Kokkos::min(a.maxCorner()[d], b.maxCorner()[d]);
+  }
+  return box;
+}
+
+template <class Tree>
+KOKKOS_FUNCTION auto nodeBoundingBox(Tree const &tree, int node)
+{
+  using Box = typename Tree::bounding_volume_type;
+  if (!HappyTreeFriends::isLeaf(tree, node))
+    return Box{HappyTreeFriends::getInternalBoundingVolume(tree, node)};
+  Box box;
+  expand(box, HappyTreeFriends::getIndexable(tree, node));
+  return box;
+}
+
+// Effective primitive overlap of a leaf: the cost of the nodes outside of
+// its path from the root that its bounding box overlaps, weighted by the
+// area of the overlap. The traversal visits all the nodes the box overlaps,
+// and the contribution of the nodes on the path, which contain the whole box,
+// is removed afterwards.
+template <class Tree>
+KOKKOS_FUNCTION double leafOverlapCost(Tree const &tree, int leaf, int depth)
+{
+  auto const leaf_box = nodeBoundingBox(tree, leaf);
+  double cost = 0;
+  int node = HappyTreeFriends::getRoot(tree);
+  do
+  {
+    auto const box = nodeBoundingBox(tree, node);
+    bool const is_leaf = HappyTreeFriends::isLeaf(tree, node);
+    if (!Details::intersects(leaf_box, box))
+    {
+      node = HappyTreeFriends::getRope(tree, node);
+      continue;
+    }
+    cost += (is_leaf ? sah_leaf_cost : sah_internal_cost) *
+            boxSurfaceArea(boxIntersection(leaf_box, box));
+    node = (is_leaf ? HappyTreeFriends::getRope(tree, node)
+                    : HappyTreeFriends::getLeftChild(tree, node));
+  } while (node != ROPE_SENTINEL);
+  return cost - (sah_internal_cost * depth + sah_leaf_cost) *
+                    boxSurfaceArea(leaf_box);
+}
+
+} // namespace Details
+} // namespace ArborX
+
+#endif
@@ -110,13 +110,50 @@ struct TreeTraversal<BVH, Predicates, Callback, SpatialPredicateTag>
       }
       else
       {
-        node =
-            (predicate(HappyTreeFriends::getInternalBoundingVolume(_bvh, node))
-                 ? HappyTreeFriends::getLeftChild(_bvh, node)
-                 : HappyTreeFriends::getRope(_bvh, node));
+        auto const &bounding_volume =
+            HappyTreeFriends::getInternalBoundingVolume(_bvh, node);
+        if (acceptsSubtree(predicate, bounding_volume))
+        {
+          if (reportSubtree(predicate, node))
+            return;
+          node = HappyTreeFriends::getRope(_bvh, node);
+        }
+        else
+        {
+          node = (overlapsSubtree(predicate, bounding_volume)
+                      ? HappyTreeFriends::getLeftChild(_bvh, node)
+                      : HappyTreeFriends::getRope(_bvh, node));
+        }
       }
     } while (node != ROPE_SENTINEL);
   }
+
+  // Report all the values in the subtree without testing them. The leaves are
+  // visited in the same order as the regular traversal, following the ropes
+  // until exiting the subtree. Returns whether the callback requested an
+  // early exit.
+  template <typename Predicate>
+  KOKKOS_FUNCTION bool reportSubtree(Predicate const &predicate,
+                                     int subtree_root) const
+  {
+    int const stop = HappyTreeFriends::getRope(_bvh, subtree_root);
+    int node = HappyTreeFriends::getLeftChild(_bvh, subtree_root);
+    while (node != stop)
+    {
+      if (HappyTreeFriends::isLeaf(_bvh, node))
+      {
+        if (invoke_callback_and_check_early_exit(
+                _callback, predicate, HappyTreeFriends::getValue(_bvh, node)))
+          return true;
+        node = HappyTreeFriends::getRope(_bvh, node);
+      }
+      else
+      {
+        node = HappyTreeFriends::getLeftChild(_bvh, node);
+      }
+    }
+    return false;
+  }
 };
 
 template <typename BVH, typename Predicates, typename Callback>
@@ -0,0 +1,391 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#ifndef ARBORX_TRIANGLE_MESH_SIGNED_DISTANCE_HPP
+#define ARBORX_TRIANGLE_MESH_SIGNED_DISTANCE_HPP
+
+#include <ArborX_LinearBVH.hpp>
+#include <ArborX_Point.hpp>
+#include <ArborX_Triangle.hpp>
+#include <algorithms/ArborX_Convert.hpp>
+#include <algorithms/ArborX_Distance.hpp>
+#include <detail/ArborX_AccessTraits.hpp>
+#include <detail/ArborX_AttachIndices.hpp>
+#include <detail/ArborX_PairValueIndex.hpp>
+#include <detail/ArborX_PointSetDistances.hpp> // updateNearest
+#include <detail/ArborX_PredicateHelpers.hpp>
+#include <kokkos_ext/ArborX_KokkosExtAccessibilityTraits.hpp>
+#include <kokkos_ext/ArborX_KokkosExtArithmeticTraits.hpp>
+#include <kokkos_ext/ArborX_KokkosExtViewHelpers.hpp>
+#include <misc/ArborX_Exception.hpp>
+#include <misc/ArborX_SortUtils.hpp>
+#include <misc/ArborX_Utils.hpp> // computeOffsetsInOrderedView
+#include <misc/ArborX_Vector.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Profiling_ScopedRegion.hpp>
+
+namespace ArborX
+{
+namespace Details
+{
+
+// Number of grid nodes along each direction of the bricks processed by a
+// single thread in the grid evaluation
+constexpr int signed_distance_brick_size = 4;
+
+template <typename Vertices, typename Triangles>
+struct TriangleMeshTriangles
+{
+  Vertices _vertices;
+  Triangles _triangles;
+};
+
+template <typename Vertices, typename Triangles>
+KOKKOS_FUNCTION auto meshTriangle(Vertices const &vertices,
+                                  Triangles const &triangles, int t)
+{
+  return Triangle{vertices(triangles(t, 0)), vertices(triangles(t, 1)),
+                  vertices(triangles(t, 2))};
+}
+
+// Angle-weighted pseudo-normals (Baerentzen and Aanaes, 2005). The normal of
+// a face is its unit normal, the normal of an edge is the sum of the normals
+// of its two faces, and the normal of a vertex is the sum of the normals of
+// its faces weighted by the incident angles. For a closed mesh, the sign of
+// the dot product of the pseudo-normal of the closest feature with the
+// direction from that feature to a point tells whether the point is outside.
+template <typename ExecutionSpace, typename Vertices, typename Triangles,
+          typename FaceNormals, typename EdgeNormals, typename VertexNormals>
+void computePseudoNormals(ExecutionSpace const &space,
+                          Vertices const &vertices, Triangles const &triangles,
+                          FaceNormals &face_normals, EdgeNormals &edge_normals,
+                          VertexNormals &vertex_normals)
+{
+  Kokkos::Profiling::ScopedRegion guard(
+      "ArborX::TriangleMeshSignedDistance::pseudo_normals");
+
+  using MemorySpace = typename Vertices::memory_space;
+  using Normal = typename FaceNormals::value_type;
+
+  int const num_vertices = vertices.size();
+  int const num_triangles = triangles.extent(0);
+
+  Kokkos::parallel_for(
+      "ArborX::TriangleMeshSignedDistance::face_normals",
+      Kokkos::RangePolicy(space, 0, num_triangles), KOKKOS_LAMBDA(int t) {
+        auto const triangle = meshTriangle(vertices, triangles, t);
+        auto const normal =
+            (triangle.b - triangle.a).cross(triangle.c - triangle.a);
+        auto const norm = normal.norm();
+        Normal face_normal;
+        // Degenerate triangles do not contribute
+        if (norm > 0)
+          for (int d = 0; d < 3; ++d)
+            face_normal[d] = normal[d] / norm;
+        face_normals(t) = face_normal;
+
+        for (int j = 0; j < 3; ++j)
+        {
+          auto const &vertex = vertices(triangles(t, j));
+          auto const u = vertices(triangles(t, (j + 1) % 3)) - vertex;
+          auto const v = vertices(triangles(t, (j + 2) % 3)) - vertex;
+          auto const angle = Kokkos::atan2(u.cross(v).norm(), u.dot(v));
+          for (int d = 0; d < 3; ++d)
+            Kokkos::atomic_add(&vertex_normals(triangles(t, j))[d],
+                               angle * face_normal[d]);
+        }
+      });
+
+  // Find the pairs of faces sharing an edge by sorting the edges
+  Kokkos::View<unsigned long long *, MemorySpace> edge_keys(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                         "ArborX::TriangleMeshSignedDistance::edge_keys"),
+      3 * num_triangles);
+  Kokkos::parallel_for(
+      "ArborX::TriangleMeshSignedDistance::edge_keys",
+      Kokkos::RangePolicy(space, 0, 3 * num_triangles), KOKKOS_LAMBDA(int e) {
+        unsigned long long v1 = triangles(e / 3, e % 3);
+        unsigned long long v2 = triangles(e / 3, (e % 3 + 1) % 3);
+        edge_keys(e) =
+            (v1 < v2 ? v1 * num_vertices + v2 : v2 * num_vertices + v1);
+      });
+  auto permute = sortObjects(space, edge_keys);
+
+  Kokkos::View<int *, MemorySpace> edge_offsets(
+      "ArborX::TriangleMeshSignedDistance::edge_offsets", 0);
+  computeOffsetsInOrderedView(space, edge_keys, edge_offsets);
+  Kokkos::parallel_for(
+      "ArborX::TriangleMeshSignedDistance::edge_normals",
+      Kokkos::RangePolicy(space, 0, edge_offsets.size() - 1),
+      KOKKOS_LAMBDA(int i) {
+        Normal edge_normal;
+        for (int k = edge_offsets(i); k < edge_offsets(i + 1); ++k)
+          for (int d = 0; d < 3; ++d)
+            edge_normal[d] += face_normals(permute(k) / 3)[d];
+        for (int k = edge_offsets(i); k < edge_offsets(i + 1); ++k)
+          edge_normals(permute(k) / 3, permute(k) % 3) = edge_normal;
+      });
+}
+
+template <typename BVH, typename Vertices, typename Triangles,
+          typename FaceNormals, typename EdgeNormals, typename VertexNormals>
+struct SignedDistanceEvaluator
+{
+  BVH _bvh;
+  Vertices _vertices;
+  Triangles _triangles;
+  FaceNormals _face_normals;
+  EdgeNormals _edge_normals;
+  VertexNormals _vertex_normals;
+
+  // Nearest triangle to the point. The search is seeded with the candidate
+  // triangle, if any, which is cheap when it is close to the nearest one.
+  template <typename Point>
+  KOKKOS_FUNCTION int nearestTriangle(Point const &point, int candidate) const
+  {
+    using Distance = decltype(Details::distance(point, point));
+    auto best = KokkosExt::ArithmeticTraits::infinity<Distance>::value;
+    int best_index = -1;
+    if (candidate >= 0)
+    {
+      best = Details::distance(
+          point, meshTriangle(_vertices, _triangles, candidate));
+      best_index = candidate;
+    }
+    updateNearest(_bvh, point, best, best_index, Distance(0));
+    return best_index;
+  }
+
+  // Signed distance to the mesh of a point whose nearest triangle is t,
+  // negative inside
+  template <typename Point>
+  KOKKOS_FUNCTION auto signedDistance(Point const &query_point, int t) const
+  {
+    auto const triangle = meshTriangle(_vertices, _triangles, t);
+    using MeshTriangle = std::decay_t<decltype(triangle)>;
+    using Vertex = std::decay_t<decltype(triangle.a)>;
+    auto const point = convert<Vertex>(query_point);
+
+    int zone;
+    auto const closest_point =
+        Dispatch::distance<GeometryTraits::PointTag,
+                           GeometryTraits::TriangleTag, Vertex,
+                           MeshTriangle>::closest_point(point, triangle.a,
+                                                        triangle.b, triangle.c,
+                                                        zone);
+    typename FaceNormals::value_type normal;
+    switch (zone)
+    {
+    case 0: // face
+      normal = _face_normals(t);
+      break;
+    case 1: // vertex a
+    case 2: // vertex b
+    case 3: // vertex c
+      normal = _vertex_normals(_triangles(t, zone - 1));
+      break;
+    case 5: // edge ab
+      normal = _edge_normals(t, 0);
+      break;
+    case 6: // edge bc
+      normal = _edge_normals(t, 1);
+      break;
+    default: // edge ca
+      normal = _edge_normals(t, 2);
+    }
+
+    auto const distance = Details::distance(point, closest_point);
+    return ((point - closest_point).dot(normal) < 0 ? -distance : distance);
+  }
+};
+
+template <typename Evaluator, typename Predicates, typename Distances>
+struct SignedDistanceCallback
+{
+  Evaluator _evaluator;
+  Predicates _points;
+  Distances _distances;
+
+  template <typename Predicate, typename Value>
+  KOKKOS_FUNCTION void operator()(Predicate const &predicate,
+                                  Value const &value) const
+  {
+    int const i = getData(predicate);
+    _distances(i) = _evaluator.signedDistance(_points(i), value.index);
+  }
+};
+
+} // namespace Details
+
+template <typename Vertices, typename Triangles>
+struct AccessTraits<Details::TriangleMeshTriangles<Vertices, Triangles>>
+{
+  using Self = Details::TriangleMeshTriangles<Vertices, Triangles>;
+
+  using memory_space = typename Vertices::memory_space;
+
+  static KOKKOS_FUNCTION auto size(Self const &self)
+  {
+    return self._triangles.extent(0);
+  }
+  static KOKKOS_FUNCTION auto get(Self const &self, int i)
+  {
+    return Details::meshTriangle(self._vertices, self._triangles, i);
+  }
+};
+
+namespace Experimental
+{
+
+// Signed distance to a closed, consistently oriented triangle mesh. The
+// distances are negative inside the mesh. The sign is computed with
+// angle-weighted pseudo-normals at the closest point, which is exact for
+// watertight meshes.
+template <typename MemorySpace, typename Coordinate = float>
+class TriangleMeshSignedDistance
+{
+  using Vertex = Point<3, Coordinate>;
+  using Normal = Details::Vector<3, Coordinate>;
+  using Vertices = Kokkos::View<Vertex *, MemorySpace>;
+  using Triangles = Kokkos::View<int *[3], MemorySpace>;
+  using BVH = BoundingVolumeHierarchy<MemorySpace,
+                                      PairValueIndex<Triangle<3, Coordinate>>>;
+  using Evaluator =
+      Details::SignedDistanceEvaluator<BVH, Vertices, Triangles,
+                                       Kokkos::View<Normal *, MemorySpace>,
+                                       Kokkos::View<Normal *[3], MemorySpace>,
+                                       Kokkos::View<Normal *, MemorySpace>>;
+
+public:
+  using memory_space = MemorySpace;
+
+  // The triangles are given by the indices of their vertices, ordered
+  // counterclockwise when seen from the outside
+  template <typename ExecutionSpace>
+  TriangleMeshSignedDistance(ExecutionSpace const &space,
+                             Vertices const &vertices,
+                             Triangles const &triangles)
+  {
+    Kokkos::Profiling::ScopedRegion guard(
+        "ArborX::TriangleMeshSignedDistance::TriangleMeshSignedDistance");
+
+    static_assert(
+        Details::KokkosExt::is_accessible_from<MemorySpace,
+                                               ExecutionSpace>::value,
+        "Memory space must be accessible from the execution space");
+
+    int const num_triangles = triangles.extent(0);
+    ARBORX_ASSERT(num_triangles > 0);
+
+    Kokkos::View<Normal *, MemorySpace> face_normals(
+        Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                           "ArborX::TriangleMeshSignedDistance::face_normals"),
+        num_triangles);
+    Kokkos::View<Normal *[3], MemorySpace> edge_normals(
+        Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                           "ArborX::TriangleMeshSignedDistance::edge_normals"),
+        num_triangles);
+    Kokkos::View<Normal *, MemorySpace> vertex_normals(
+        Kokkos::view_alloc(
+            space, "ArborX::TriangleMeshSignedDistance::vertex_normals"),
+        vertices.size());
+    Details::computePseudoNormals(space, vertices, triangles, face_normals,
+                                  edge_normals, vertex_normals);
+
+    Kokkos::Profiling::pushRegion(
+        "ArborX::TriangleMeshSignedDistance::construction");
+    BVH bvh(space, attach_indices(Details::TriangleMeshTriangles<
+                                  Vertices, Triangles>{vertices, triangles}));
+    Kokkos::Profiling::popRegion();
+
+    _evaluator = Evaluator{bvh,          vertices,     triangles,
+                           face_normals, edge_normals, vertex_normals};
+  }
+
+  // Signed distances to scattered points
+  template <typename ExecutionSpace, typename Points, typename Distances>
+  void evaluate(ExecutionSpace const &space, Points const &points,
+                Distances &distances) const
+  {
+    Kokkos::Profiling::ScopedRegion guard(
+        "ArborX::TriangleMeshSignedDistance::evaluate");
+
+    static_assert(Kokkos::is_view_v<Points> && Kokkos::is_view_v<Distances>);
+    static_assert(GeometryTraits::is_point_v<typename Points::value_type>);
+
+    Details::KokkosExt::reallocWithoutInitializing(space, distances,
+                                                   points.size());
+    _evaluator._bvh.query(
+        space, attach_indices(make_nearest(points, 1)),
+        Details::SignedDistanceCallback<Evaluator, Points, Distances>{
+            _evaluator, points, distances});
+  }
+
+  // Signed distances to the nodes of a regular grid. The node (i, j, k) is
+  // located at origin + spacing * (i, j, k), and its distance is stored at
+  // i + nx * (j + ny * k).
+  //
+  // The grid is processed by bricks of nodes, each by a single thread. The
+  // search for the nearest triangle of a node is seeded with the nearest
+  // triangle of the previous node, which is usually the same or a neighbor.
+  template <typename ExecutionSpace, typename Distances>
+  void evaluateOnGrid(ExecutionSpace const &space, Vertex const &origin,
+                      Coordinate spacing, int nx, int ny, int nz,
+                      Distances &distances) const
+  {
+    Kokkos::Profiling::ScopedRegion guard(
+        "ArborX::TriangleMeshSignedDistance::evaluate_on_grid");
+
+    static_assert(Kokkos::is_view_v<Distances>);
+    ARBORX_ASSERT(nx >= 0 && ny >= 0 && nz >= 0);
+
+    constexpr int brick_size = Details::signed_distance_brick_size;
+    int const bx = (nx + brick_size - 1) / brick_size;
+    int const by = (ny + brick_size - 1) / brick_size;
+    int const bz = (nz + brick_size - 1) / brick_size;
+
+    Details::KokkosExt::reallocWithoutInitializing(space, distances,
+                                                   (size_t)nx * ny * nz);
+    auto const &evaluator = _evaluator;
+    Kokkos::parallel_for(
+        "ArborX::TriangleMeshSignedDistance::evaluate_bricks",
+        Kokkos::RangePolicy(space, 0, bx * by * bz), KOKKOS_LAMBDA(int brick) {
+          int const brick_i = brick % bx;
+          int const brick_j = (brick / bx) % by;
+          int const brick_k = brick / (bx * by);
+          int const i_end = Kokkos::min((brick_i + 1) * brick_size, nx);
+          int const j_end = Kokkos::min((brick_j + 1) * brick_size, ny);
+          int const k_end = Kokkos::min((brick_k + 1) * brick_size, nz);
+          int candidate = -1;
+          for (int k = brick_k * brick_size; k < k_end; ++k)
+            for (int j = brick_j * brick_size; j < j_end; ++j)
+              for (int i = brick_i * brick_size; i < i_end; ++i)
+              {
+                Vertex const node{origin[0] + i * spacing,
+                                  origin[1] + j * spacing,
+                                  origin[2] + k * spacing};
+                candidate = evaluator.nearestTriangle(node, candidate);
+                distances(i + (size_t)nx * (j + (size_t)ny * k)) =
+                    evaluator.signedDistance(node, candidate);
+              }
+        });
+  }
+
+private:
+  Evaluator _evaluator;
+};
+
+} // namespace Experimental
+
+} // namespace ArborX
+
+#endif
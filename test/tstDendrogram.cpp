@@ -237,4 +237,25 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(dendrogram_boruvka_same_weights, DeviceType,
   BOOST_TEST(wrong_counts == 0);
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(dendrogram_memory_footprint, DeviceType,
+                              ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using MemorySpace = typename DeviceType::memory_space;
+
+  ExecutionSpace space;
+
+  auto edges = ArborXTest::toView<ExecutionSpace>(
+      std::vector<WeightedEdge>{{0, 3, 7.f}, {1, 2, 3.f}, {0, 1, 2.f}},
+      "Test::edges");
+  ArborX::Experimental::Dendrogram<MemorySpace> dendrogram{space, edges};
+
+  // Parents of the 3 edges and 4 vertices, and heights of the edges
+  BOOST_TEST(dendrogram.memory_footprint() ==
+             (3 + 4) * sizeof(int) + 3 * sizeof(float));
+  BOOST_TEST(dendrogram.memory_footprint() ==
+             dendrogram._parents.span() * sizeof(int) +
+                 dendrogram._parent_heights.span() * sizeof(float));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -11,12 +11,16 @@
 
 #include <ArborX_Box.hpp>
 #include <ArborX_Ellipsoid.hpp>
+#include <ArborX_Metrics.hpp>
 #include <ArborX_Point.hpp>
 #include <ArborX_Segment.hpp>
+#include <ArborX_SpatioTemporal.hpp>
 #include <ArborX_Sphere.hpp>
+#include <ArborX_SphericalCap.hpp>
 #include <ArborX_Tetrahedron.hpp>
 #include <ArborX_Triangle.hpp>
 #include <algorithms/ArborX_Centroid.hpp>
+#include <algorithms/ArborX_Contains.hpp>
 #include <algorithms/ArborX_Convert.hpp>
 #include <algorithms/ArborX_Distance.hpp>
 #include <algorithms/ArborX_Equals.hpp>
@@ -30,6 +34,9 @@
 #define BOOST_TEST_MODULE Geometry
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
+#include <limits>
+
 using Point = ArborX::Point<3>;
 using Box = ArborX::Box<3>;
 using Sphere = ArborX::Sphere<3>;
@@ -218,6 +225,169 @@ BOOST_AUTO_TEST_CASE(distance_sphere_box)
   BOOST_TEST(distance(sphere, Box{}) == infinity);
 }
 
+BOOST_AUTO_TEST_CASE(distance_metrics)
+{
+  using ArborX::Experimental::Chebyshev;
+  using ArborX::Experimental::Euclidean;
+  using ArborX::Experimental::Manhattan;
+  using ArborX::Experimental::WeightedEuclidean;
+
+  constexpr Euclidean l2{};
+  constexpr Manhattan l1{};
+  constexpr Chebyshev linf{};
+  constexpr WeightedEuclidean<3> w149{{1.f, 4.f, 9.f}};
+  constexpr WeightedEuclidean<3> w411{{4.f, 1.f, 1.f}};
+  constexpr WeightedEuclidean<3> w114{{1.f, 1.f, 4.f}};
+  constexpr WeightedEuclidean<3> w911{{9.f, 1.f, 1.f}};
+
+  constexpr Box unit_box{{{0.0, 0.0, 0.0}}, {{1.0, 1.0, 1.0}}};
+
+  // point-point
+  BOOST_TEST(l2.distance(Point{{1, 2, 3}}, Point{{1, 1, 1}}) ==
+             std::sqrt(5.f));
+  BOOST_TEST(l1.distance(Point{{1, 2, 3}}, Point{{0, 3, 1}}) == 4);
+  BOOST_TEST(linf.distance(Point{{1, 2, 3}}, Point{{0, 3, 1}}) == 2);
+  BOOST_TEST(w149.distance(Point{{1, 2, 3}}, Point{{0, 3, 1}}) ==
+             std::sqrt(41.f));
+
+  // point-box: zero inside or on the boundary of the box
+  BOOST_TEST(l1.distance(Point{{0.5, 0.5, 0.5}}, unit_box) == 0);
+  BOOST_TEST(linf.distance(Point{{0.0, 0.0, 0.5}}, unit_box) == 0);
+  BOOST_TEST(w149.distance(Point{{1.0, 0.5, 0.5}}, unit_box) == 0);
+  // point-box: projection onto a face, an edge, and a corner
+  BOOST_TEST(l1.distance(Point{{2.0, 0.5, 0.5}}, unit_box) == 1);
+  BOOST_TEST(l1.distance(Point{{2.0, 0.75, -1.0}}, unit_box) == 2);
+  BOOST_TEST(l1.distance(Point{{-1.0, 2.0, 3.0}}, unit_box) == 4);
+  BOOST_TEST(linf.distance(Point{{2.0, 0.5, 0.5}}, unit_box) == 1);
+  BOOST_TEST(linf.distance(Point{{3.0, 0.75, -1.0}}, unit_box) == 2);
+  BOOST_TEST(linf.distance(Point{{-1.0, 2.0, 3.0}}, unit_box) == 2);
+  BOOST_TEST(w411.distance(Point{{2.0, 0.5, 0.5}}, unit_box) == 2);
+  BOOST_TEST(w114.distance(Point{{2.0, 0.75, -1.0}}, unit_box) ==
+             std::sqrt(5.f));
+  // point-box is symmetric
+  BOOST_TEST(l1.distance(unit_box, Point{{-1.0, 2.0, 3.0}}) == 4);
+
+  // box-box
+  constexpr Box other_box{{{2, -3, 0}}, {{3, -2, 1}}};
+  BOOST_TEST(l1.distance(unit_box, unit_box) == 0);
+  BOOST_TEST(l1.distance(unit_box, other_box) == 3);
+  BOOST_TEST(linf.distance(unit_box, other_box) == 2);
+  BOOST_TEST(w911.distance(unit_box, other_box) == std::sqrt(13.f));
+
+  // the point-box distance is a lower bound of the distance to any point
+  // within the box
+  constexpr Point query{{-1.0, 2.0, 3.0}};
+  for (auto const &point :
+       {Point{{0, 0, 0}}, Point{{1, 1, 1}}, Point{{0.5, 0.25, 1}}})
+  {
+    BOOST_TEST(l1.distance(query, unit_box) <= l1.distance(query, point));
+    BOOST_TEST(linf.distance(query, unit_box) <= linf.distance(query, point));
+    BOOST_TEST(w149.distance(query, unit_box) <= w149.distance(query, point));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(distance_great_circle)
+{
+  using ArborX::Experimental::geographicToCartesian;
+  using ArborX::Experimental::GreatCircle;
+
+  constexpr float pi = Kokkos::numbers::pi_v<float>;
+  constexpr GreatCircle<> unit_sphere{};
+  constexpr GreatCircle<> earth{6371.f};
+
+  auto const north_pole = geographicToCartesian(90.f, 0.f);
+  auto const south_pole = geographicToCartesian(-90.f, 0.f);
+  auto const equator_0 = geographicToCartesian(0.f, 0.f);
+  auto const equator_90 = geographicToCartesian(0.f, 90.f);
+
+  BOOST_TEST(unit_sphere.distance(north_pole, north_pole) == 0);
+  BOOST_TEST(unit_sphere.distance(north_pole, equator_0) == pi / 2,
+             boost::test_tools::tolerance(1e-6f));
+  BOOST_TEST(unit_sphere.distance(equator_0, equator_90) == pi / 2,
+             boost::test_tools::tolerance(1e-6f));
+  BOOST_TEST(unit_sphere.distance(north_pole, south_pole) == pi,
+             boost::test_tools::tolerance(1e-6f));
+  BOOST_TEST(earth.distance(north_pole, equator_90) == 6371.f * pi / 2,
+             boost::test_tools::tolerance(1e-5f));
+
+  // across the antimeridian
+  BOOST_TEST(unit_sphere.distance(geographicToCartesian(0.f, 179.f),
+                                  geographicToCartesian(0.f, -179.f)) ==
+                 2 * pi / 180,
+             boost::test_tools::tolerance(1e-3f));
+  // near the pole, points far apart in longitude are close
+  BOOST_TEST(unit_sphere.distance(geographicToCartesian(89.f, 0.f),
+                                  geographicToCartesian(89.f, 180.f)) ==
+                 2 * pi / 180,
+             boost::test_tools::tolerance(1e-3f));
+
+  // the distance to a box is a lower bound of the distance to any point of
+  // the sphere within the box
+  auto const a = geographicToCartesian(10.f, 20.f);
+  auto const b = geographicToCartesian(30.f, 60.f);
+  Box box;
+  ArborX::Details::expand(box, a);
+  ArborX::Details::expand(box, b);
+  BOOST_TEST(unit_sphere.distance(north_pole, box) <=
+             unit_sphere.distance(north_pole, a));
+  BOOST_TEST(unit_sphere.distance(north_pole, box) <=
+             unit_sphere.distance(north_pole, b));
+  BOOST_TEST(unit_sphere.distance(a, box) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(distance_mahalanobis)
+{
+  using ArborX::Experimental::Ellipsoid;
+  using ArborX::Experimental::Mahalanobis;
+
+  constexpr Mahalanobis<3> diagonal{
+      {{1.f, 0.f, 0.f}, {0.f, 4.f, 0.f}, {0.f, 0.f, 9.f}}};
+  constexpr Mahalanobis<3> correlated{
+      {{2.f, 1.f, 0.f}, {1.f, 2.f, 0.5f}, {0.f, 0.5f, 1.f}}};
+
+  // point-point
+  BOOST_TEST(diagonal.distance(Point{{1, 2, 3}}, Point{{0, 3, 1}}) ==
+             std::sqrt(41.f));
+  // v = (1,-1,2), Mv = (1,0,1.5)
+  BOOST_TEST(correlated.distance(Point{{1, 0, 2}}, Point{{0, 1, 0}}) == 2);
+
+  // metric of an ellipsoid: the boundary is at distance one from the center
+  Ellipsoid const ellipse{{1.f, 0.f}, {{2.f, 1.f}, {1.f, 2.f}}};
+  Mahalanobis const ellipse_metric{ellipse.rmt()};
+  ArborX::Point<2> const p0{1.f, 0.f};
+  ArborX::Point<2> const p1{1.f + 1 / std::sqrt(2.f), 0.f};
+  BOOST_TEST(ellipse_metric.distance(p0, p1) == 1.f,
+             boost::test_tools::tolerance(1e-6f));
+
+  // point-box: zero inside the box, exact for degenerate boxes
+  constexpr Box unit_box{{{0.0, 0.0, 0.0}}, {{1.0, 1.0, 1.0}}};
+  BOOST_TEST(correlated.distance(Point{{0.5, 0.5, 0.5}}, unit_box) == 0);
+  BOOST_TEST(correlated.distance(Point{{1, 0, 2}},
+                                 Box{{{0, 1, 0}}, {{0, 1, 0}}}) ==
+             correlated.distance(Point{{1, 0, 2}}, Point{{0, 1, 0}}));
+  BOOST_TEST(diagonal.distance(Point{{2.0, 0.5, -1.0}}, unit_box) ==
+             std::sqrt(10.f));
+
+  // point-box is a lower bound of the distance to any point of the box
+  for (auto const &query :
+       {Point{{-1, 2, 3}}, Point{{2, -1, 0.5}}, Point{{0.5, 3, -2}}})
+  {
+    auto const bound = correlated.distance(query, unit_box);
+    auto min_distance = std::numeric_limits<float>::max();
+    for (int i = 0; i <= 10; ++i)
+      for (int j = 0; j <= 10; ++j)
+        for (int k = 0; k <= 10; ++k)
+        {
+          Point const point{{i / 10.f, j / 10.f, k / 10.f}};
+          auto const dist = correlated.distance(query, point);
+          BOOST_TEST(bound <= dist);
+          min_distance = std::min(min_distance, dist);
+        }
+    BOOST_TEST(bound == min_distance, boost::test_tools::tolerance(0.1f));
+    BOOST_TEST(correlated.distance(unit_box, query) == bound);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(intersects)
 {
   using ArborX::Details::intersects;
@@ -380,6 +550,129 @@ BOOST_AUTO_TEST_CASE(intersects)
   BOOST_TEST(!intersects(ellipse, Box2{{2.1, 2.1}, {3, 3}}));
 }
 
+BOOST_AUTO_TEST_CASE(intersects_spherical_cap)
+{
+  using ArborX::Details::intersects;
+  using ArborX::Experimental::geographicToCartesian;
+  using ArborX::Experimental::SphericalCap;
+
+  constexpr float degree = Kokkos::numbers::pi_v<float> / 180;
+
+  // cap of 10 degrees around the north pole
+  SphericalCap const polar_cap{geographicToCartesian(90.f, 0.f), 10 * degree};
+  BOOST_TEST(intersects(polar_cap, geographicToCartesian(85.f, 0.f)));
+  BOOST_TEST(intersects(polar_cap, geographicToCartesian(85.f, 180.f)));
+  BOOST_TEST(intersects(polar_cap, geographicToCartesian(81.f, -90.f)));
+  BOOST_TEST(!intersects(polar_cap, geographicToCartesian(79.f, 45.f)));
+  BOOST_TEST(!intersects(polar_cap, geographicToCartesian(-85.f, 0.f)));
+
+  // cap straddling the antimeridian
+  SphericalCap const cap{geographicToCartesian(0.f, 180.f), 5 * degree};
+  BOOST_TEST(intersects(cap, geographicToCartesian(0.f, 176.f)));
+  BOOST_TEST(intersects(cap, geographicToCartesian(0.f, -176.f)));
+  BOOST_TEST(intersects(geographicToCartesian(3.f, -178.f), cap));
+  BOOST_TEST(!intersects(cap, geographicToCartesian(0.f, 170.f)));
+
+  // boxes around points on the sphere
+  auto make_box = [](auto const &p, auto const &q) {
+    Box box;
+    ArborX::Details::expand(box, p);
+    ArborX::Details::expand(box, q);
+    return box;
+  };
+  BOOST_TEST(intersects(polar_cap, make_box(geographicToCartesian(85.f, 0.f),
+                                            geographicToCartesian(70.f, 0.f))));
+  BOOST_TEST(intersects(cap, make_box(geographicToCartesian(0.f, 170.f),
+                                      geographicToCartesian(0.f, -170.f))));
+  BOOST_TEST(!intersects(polar_cap,
+                         make_box(geographicToCartesian(0.f, 0.f),
+                                  geographicToCartesian(10.f, 10.f))));
+  // boxes that do not reach the unit sphere
+  Box const inner_box{{{-0.1f, -0.1f, 0.5f}}, {{0.1f, 0.1f, 0.9f}}};
+  Box const outer_box{{{-0.1f, -0.1f, 1.1f}}, {{0.1f, 0.1f, 1.5f}}};
+  Box const shell_box{{{-0.1f, -0.1f, 0.9f}}, {{0.1f, 0.1f, 1.1f}}};
+  BOOST_TEST(!intersects(polar_cap, inner_box));
+  BOOST_TEST(!intersects(polar_cap, outer_box));
+  BOOST_TEST(intersects(shell_box, polar_cap));
+
+  // caps larger than a hemisphere
+  SphericalCap const large_cap{geographicToCartesian(90.f, 0.f), 170 * degree};
+  BOOST_TEST(intersects(large_cap, geographicToCartesian(-75.f, 30.f)));
+  BOOST_TEST(!intersects(large_cap, geographicToCartesian(-85.f, 30.f)));
+}
+
+BOOST_AUTO_TEST_CASE(intersects_spatio_temporal)
+{
+  using ArborX::Details::intersects;
+  using ArborX::Experimental::SpatioTemporal;
+  using Point4 = ArborX::Point<4>;
+  using Box4 = ArborX::Box<4>;
+
+  // unit sphere around the origin during [1, 2]
+  SpatioTemporal const region{Sphere{{0.f, 0.f, 0.f}, 1.f}, 1.f, 2.f};
+  BOOST_TEST(intersects(region, Point4{0.5f, 0.f, 0.f, 1.5f}));
+  BOOST_TEST(intersects(region, Point4{0.f, 0.f, 1.f, 1.f}));
+  BOOST_TEST(intersects(region, Point4{0.f, 0.f, 0.f, 2.f}));
+  BOOST_TEST(!intersects(region, Point4{0.5f, 0.f, 0.f, 0.9f}));
+  BOOST_TEST(!intersects(region, Point4{0.5f, 0.f, 0.f, 2.1f}));
+  BOOST_TEST(!intersects(region, Point4{1.f, 1.f, 0.f, 1.5f}));
+
+  // trajectory segments
+  auto segment = [](float x_begin, float t_begin, float x_end, float t_end) {
+    return Box4{{x_begin, 0.f, 0.f, t_begin}, {x_end, 0.f, 0.f, t_end}};
+  };
+  BOOST_TEST(intersects(region, segment(0.5f, 0.f, 3.f, 3.f)));
+  BOOST_TEST(intersects(region, segment(0.5f, 0.f, 3.f, 1.f)));
+  BOOST_TEST(!intersects(region, segment(0.5f, 0.f, 3.f, 0.5f)));
+  BOOST_TEST(!intersects(region, segment(0.5f, 2.5f, 3.f, 3.f)));
+  BOOST_TEST(!intersects(region, segment(1.5f, 0.f, 3.f, 3.f)));
+
+  // box region
+  SpatioTemporal const box_region{Box{{{0.f, 0.f, 0.f}}, {{1.f, 1.f, 1.f}}},
+                                  -1.f, 1.f};
+  BOOST_TEST(intersects(box_region, Point4{0.5f, 0.5f, 0.5f, 0.f}));
+  BOOST_TEST(!intersects(box_region, Point4{0.5f, 0.5f, 1.5f, 0.f}));
+  BOOST_TEST(!intersects(box_region, Point4{0.5f, 0.5f, 0.5f, 1.5f}));
+
+  using ArborX::Details::equals;
+  using ArborX::Details::returnCentroid;
+  BOOST_TEST(equals(returnCentroid(region), Point4{0.f, 0.f, 0.f, 1.5f}));
+  BOOST_TEST(
+      equals(returnCentroid(box_region), Point4{0.5f, 0.5f, 0.5f, 0.f}));
+}
+
+BOOST_AUTO_TEST_CASE(contains)
+{
+  using ArborX::Details::contains;
+
+  Box const unit_box{{{0.f, 0.f, 0.f}}, {{1.f, 1.f, 1.f}}};
+  BOOST_TEST(contains(unit_box, Point{0.5f, 0.5f, 0.5f}));
+  BOOST_TEST(contains(unit_box, Point{1.f, 1.f, 1.f}));
+  BOOST_TEST(!contains(unit_box, Point{1.5f, 0.5f, 0.5f}));
+  BOOST_TEST(contains(unit_box, unit_box));
+  BOOST_TEST(
+      contains(unit_box, Box{{{0.2f, 0.2f, 0.2f}}, {{0.8f, 0.8f, 1.f}}}));
+  BOOST_TEST(
+      !contains(unit_box, Box{{{0.2f, 0.2f, 0.2f}}, {{0.8f, 0.8f, 2.f}}}));
+  BOOST_TEST(!contains(Box{{{0.2f, 0.2f, 0.2f}}, {{0.8f, 0.8f, 0.8f}}},
+                       unit_box));
+  BOOST_TEST(contains(unit_box, Sphere{{{0.5f, 0.5f, 0.5f}}, 0.5f}));
+  BOOST_TEST(!contains(unit_box, Sphere{{{0.5f, 0.5f, 0.5f}}, 0.6f}));
+
+  Sphere const unit_sphere{{{0.f, 0.f, 0.f}}, 1.f};
+  BOOST_TEST(contains(unit_sphere, Point{0.f, 0.f, 1.f}));
+  BOOST_TEST(!contains(unit_sphere, Point{1.f, 1.f, 0.f}));
+  // the sphere intersects the box but does not contain its far corner
+  BOOST_TEST(!contains(unit_sphere, unit_box));
+  BOOST_TEST(contains(unit_sphere, Box{{{0.f, 0.f, 0.f}}, {{.5f, .5f, .5f}}}));
+  BOOST_TEST(
+      contains(unit_sphere, Box{{{-.5f, -.5f, -.5f}}, {{0.f, 0.f, 0.f}}}));
+  BOOST_TEST(
+      !contains(unit_sphere, Box{{{-.5f, 0.f, 0.f}}, {{.5f, 1.f, 0.f}}}));
+  BOOST_TEST(contains(unit_sphere, Sphere{{{0.5f, 0.f, 0.f}}, 0.5f}));
+  BOOST_TEST(!contains(unit_sphere, Sphere{{{0.5f, 0.f, 0.f}}, 0.6f}));
+}
+
 BOOST_AUTO_TEST_CASE(equals)
 {
   using ArborX::Details::equals;
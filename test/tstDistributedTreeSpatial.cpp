@@ -548,3 +548,42 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(boost_comparison, DeviceType, ARBORX_DEVICE_TYPES)
   ARBORX_TEST_QUERY_TREE(ExecutionSpace{}, distributed_tree, within_queries,
                          query(ExecutionSpace{}, rtree, within_queries_host));
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(memory_footprint, DeviceType, ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using MemorySpace = typename DeviceType::memory_space;
+  using Point = ArborX::Point<3>;
+  using Box = ArborX::Box<3>;
+  using Tree =
+      ArborX::DistributedTree<MemorySpace, ArborXTest::PairIndexRank,
+                              PairIndexRankIndexableGetter<MemorySpace, Point>>;
+  using size_type = typename Tree::size_type;
+
+  MPI_Comm comm = MPI_COMM_WORLD;
+  int comm_rank;
+  MPI_Comm_rank(comm, &comm_rank);
+  int comm_size;
+  MPI_Comm_size(comm, &comm_size);
+
+  BOOST_TEST(Tree().memory_footprint() == 0u);
+
+  int const n = 1 + comm_rank;
+  std::vector<Point> points(n);
+  for (int i = 0; i < n; ++i)
+    points[i] = {{(float)i, (float)comm_rank, 0.f}};
+  auto const tree =
+      makeDistributedTree<DeviceType>(comm, ExecutionSpace{}, points);
+
+  // Nodes of the local tree and of the replicated tree of the bounding boxes
+  // of the ranks, and sizes of the local trees
+  using InternalNode = ArborX::Details::InternalNode<Box>;
+  using BottomLeafNode = ArborX::Details::LeafNode<ArborXTest::PairIndexRank>;
+  using TopLeafNode =
+      ArborX::Details::LeafNode<ArborX::PairValueIndex<Box, int>>;
+  BOOST_TEST(tree.memory_footprint() ==
+             n * sizeof(BottomLeafNode) + (n - 1) * sizeof(InternalNode) +
+                 comm_size * sizeof(TopLeafNode) +
+                 (comm_size - 1) * sizeof(InternalNode) +
+                 comm_size * sizeof(size_type));
+}
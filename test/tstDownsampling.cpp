@@ -0,0 +1,180 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+#include "ArborXTest_Cloud.hpp"
+#include "ArborXTest_StdVectorToKokkosView.hpp"
+#include "ArborX_EnableDeviceTypes.hpp" // ARBORX_DEVICE_TYPES
+#include <ArborX_Downsampling.hpp>
+
+#include "BoostTest_CUDA_clang_workarounds.hpp"
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <set>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(Downsampling)
+
+namespace tt = boost::test_tools;
+
+template <typename Indices>
+std::vector<int> sortedIndices(Indices const &indices)
+{
+  auto indices_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, indices);
+  std::vector<int> v(indices_host.data(),
+                     indices_host.data() + indices_host.size());
+  std::sort(v.begin(), v.end());
+  return v;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(voxel_downsample, DeviceType,
+                              ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using MemorySpace = typename DeviceType::memory_space;
+  using Point = ArborX::Point<2>;
+  ExecutionSpace space;
+
+  Kokkos::View<int *, MemorySpace> indices("Test::indices", 0);
+
+  ArborX::Experimental::voxelDownsample(
+      space, Kokkos::View<Point *, MemorySpace>("Test::points", 0), 1.f,
+      indices);
+  BOOST_TEST(indices.size() == 0);
+
+  // Voxels [0, 1)^2 (three points), [1, 2)x[0, 1) and [3, 4)^2
+  auto points = ArborXTest::toView<ExecutionSpace>(
+      std::vector<Point>{
+          {0.f, 0.f}, {0.4f, 0.4f}, {0.6f, 0.5f}, {1.5f, 0.2f}, {3.f, 3.f}},
+      "Test::points");
+  ArborX::Experimental::voxelDownsample(space, points, 1.f, indices);
+  BOOST_TEST(sortedIndices(indices) == (std::vector<int>{2, 3, 4}),
+             tt::per_element());
+
+  // A single voxel
+  ArborX::Experimental::voxelDownsample(space, points, 10.f, indices);
+  BOOST_TEST(sortedIndices(indices) == (std::vector<int>{4}),
+             tt::per_element());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(voxel_downsample_random, DeviceType,
+                              ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using MemorySpace = typename DeviceType::memory_space;
+  using Point = ArborX::Point<3>;
+  ExecutionSpace space;
+
+  auto points = ArborXTest::make_random_cloud<Point>(space, 2000);
+  float const voxel_size = 0.07f;
+
+  Kokkos::View<int *, MemorySpace> indices("Test::indices", 0);
+  ArborX::Experimental::voxelDownsample(space, points, voxel_size, indices);
+
+  auto points_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, points);
+  int const n = points_host.size();
+
+  Point min_corner = points_host(0);
+  for (int i = 1; i < n; ++i)
+    for (int d = 0; d < 3; ++d)
+      min_corner[d] = std::min(min_corner[d], points_host(i)[d]);
+  auto voxel = [&](int i) {
+    std::array<int, 3> v;
+    for (int d = 0; d < 3; ++d)
+      v[d] = std::floor((points_host(i)[d] - min_corner[d]) / voxel_size);
+    return v;
+  };
+
+  std::set<std::array<int, 3>> voxels;
+  for (int i = 0; i < n; ++i)
+    voxels.insert(voxel(i));
+
+  // One point in each nonempty voxel
+  std::set<std::array<int, 3>> kept_voxels;
+  for (int i : sortedIndices(indices))
+    kept_voxels.insert(voxel(i));
+  BOOST_TEST(indices.size() == voxels.size());
+  BOOST_TEST(kept_voxels.size() == voxels.size());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(poisson_disk_downsample, DeviceType,
+                              ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using MemorySpace = typename DeviceType::memory_space;
+  using Point = ArborX::Point<3>;
+  ExecutionSpace space;
+
+  Kokkos::View<int *, MemorySpace> indices("Test::indices", 0);
+
+  // Isolated points are all kept
+  auto points = ArborXTest::toView<ExecutionSpace>(
+      std::vector<Point>{{0.f, 0.f, 0.f}, {2.f, 0.f, 0.f}, {0.f, 2.f, 0.f}},
+      "Test::points");
+  ArborX::Experimental::poissonDiskDownsample(space, points, 1.f, indices);
+  BOOST_TEST(sortedIndices(indices) == (std::vector<int>{0, 1, 2}),
+             tt::per_element());
+
+  // Only one of coincident points is kept
+  points = ArborXTest::toView<ExecutionSpace>(
+      std::vector<Point>(5, {1.f, 1.f, 1.f}), "Test::points");
+  ArborX::Experimental::poissonDiskDownsample(space, points, 0.f, indices);
+  BOOST_TEST(indices.size() == 1);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(poisson_disk_downsample_random, DeviceType,
+                              ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using MemorySpace = typename DeviceType::memory_space;
+  using Point = ArborX::Point<3>;
+  ExecutionSpace space;
+
+  auto points = ArborXTest::make_random_cloud<Point>(space, 2000);
+  float const radius = 0.08f;
+
+  Kokkos::View<int *, MemorySpace> indices("Test::indices", 0);
+  ArborX::Experimental::poissonDiskDownsample(space, points, radius, indices,
+                                              42);
+
+  auto points_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, points);
+  int const n = points_host.size();
+  auto const selected = sortedIndices(indices);
+  BOOST_TEST(!selected.empty());
+  BOOST_TEST(std::adjacent_find(selected.begin(), selected.end()) ==
+             selected.end());
+
+  using ArborX::Details::distance;
+
+  // The selected points are more than the radius apart
+  for (std::size_t a = 0; a < selected.size(); ++a)
+    for (std::size_t b = a + 1; b < selected.size(); ++b)
+      BOOST_TEST(distance(points_host(selected[a]), points_host(selected[b])) >
+                 radius);
+
+  // Every point is within the radius of a selected point
+  for (int i = 0; i < n; ++i)
+    BOOST_TEST(std::any_of(selected.begin(), selected.end(), [&](int j) {
+      return distance(points_host(i), points_host(j)) <= radius;
+    }));
+
+  // The selection only depends on the seed
+  Kokkos::View<int *, MemorySpace> other_indices("Test::other_indices", 0);
+  ArborX::Experimental::poissonDiskDownsample(space, points, radius,
+                                              other_indices, 42);
+  BOOST_TEST(sortedIndices(other_indices) == selected, tt::per_element());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -66,6 +66,8 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(moving_least_squares, DeviceType,
       ArborX::Interpolation::PolynomialDegree<1>{}, 2);
   mls0.interpolate(space, srcv0, eval0);
   ARBORX_MDVIEW_TEST_TOL(eval0, tgtv0, Kokkos::Experimental::epsilon_v<float>);
+  // Coefficients and indices of the 2 neighbors of the 3 targets
+  BOOST_TEST(mls0.memory_footprint() == 3 * 2 * (sizeof(double) + sizeof(int)));
 
   // Case 2: f(x, y) = xy + 4x, 8 neighbors, quad
   //        ^
@@ -104,6 +106,7 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(moving_least_squares, DeviceType,
       ArborX::Interpolation::PolynomialDegree<2>{}, 8);
   mls1.interpolate(space, srcv1, eval1);
   ARBORX_MDVIEW_TEST_TOL(eval1, tgtv1, Kokkos::Experimental::epsilon_v<float>);
+  BOOST_TEST(mls1.memory_footprint() == 4 * 8 * (sizeof(double) + sizeof(int)));
 }
 
 BOOST_AUTO_TEST_CASE_TEMPLATE(moving_least_squares_edge_cases, DeviceType,
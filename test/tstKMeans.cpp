@@ -0,0 +1,127 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+#include "ArborXTest_Cloud.hpp"
+#include "ArborXTest_StdVectorToKokkosView.hpp"
+#include "ArborX_EnableDeviceTypes.hpp" // ARBORX_DEVICE_TYPES
+#include <ArborX_KMeans.hpp>
+
+#include "BoostTest_CUDA_clang_workarounds.hpp"
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <set>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(KMeans)
+
+namespace tt = boost::test_tools;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(kmeans_separated_clusters, DeviceType,
+                              ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using MemorySpace = typename DeviceType::memory_space;
+  using Point = ArborX::Point<2>;
+  ExecutionSpace space;
+
+  // Three clusters of four points, centered at (0, 0), (10, 0) and (0, 10)
+  std::vector<Point> points_host;
+  for (auto const &center :
+       std::vector<Point>{{0.f, 0.f}, {10.f, 0.f}, {0.f, 10.f}})
+    for (auto const &offset : std::vector<Point>{
+             {-1.f, 0.f}, {1.f, 0.f}, {0.f, -1.f}, {0.f, 1.f}})
+      points_host.push_back(
+          {center[0] + offset[0], center[1] + offset[1]});
+  auto points = ArborXTest::toView<ExecutionSpace>(points_host, "Test::points");
+
+  Kokkos::View<int *, MemorySpace> labels("Test::labels", 0);
+  Kokkos::View<Point *, MemorySpace> centroids("Test::centroids", 0);
+  ArborX::Experimental::kmeans(space, points, 3, labels, centroids);
+
+  auto labels_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, labels);
+  auto centroids_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, centroids);
+  BOOST_TEST(labels_host.size() == 12);
+  BOOST_TEST(centroids_host.size() == 3);
+
+  std::set<int> cluster_labels;
+  for (int cluster = 0; cluster < 3; ++cluster)
+  {
+    int const label = labels_host(4 * cluster);
+    for (int i = 4 * cluster; i < 4 * (cluster + 1); ++i)
+      BOOST_TEST(labels_host(i) == label);
+    cluster_labels.insert(label);
+
+    auto const &center = points_host[4 * cluster];
+    BOOST_TEST(centroids_host(label)[0] == center[0] + 1.f,
+               tt::tolerance(1e-6f));
+    BOOST_TEST(centroids_host(label)[1] == center[1], tt::tolerance(1e-6f));
+  }
+  BOOST_TEST(cluster_labels.size() == 3);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(kmeans_brute_force, DeviceType,
+                              ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using MemorySpace = typename DeviceType::memory_space;
+  using Point = ArborX::Point<3>;
+  ExecutionSpace space;
+
+  auto points = ArborXTest::make_random_cloud<Point>(space, 1000);
+  int const k = 17;
+
+  Kokkos::View<int *, MemorySpace> labels("Test::labels", 0);
+  Kokkos::View<Point *, MemorySpace> centroids("Test::centroids", 0);
+  int const num_iterations = ArborX::Experimental::kmeans(
+      space, points, k, labels, centroids,
+      ArborX::Experimental::KMeans::Parameters().setMaxIterations(1000));
+  BOOST_TEST(num_iterations < 1000);
+
+  auto points_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, points);
+  auto labels_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, labels);
+  auto centroids_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, centroids);
+  int const n = points_host.size();
+
+  // At convergence, the points are assigned to their nearest centroid and
+  // the centroids are the means of their clusters
+  using ArborX::Details::distance;
+  std::vector<Point> sums(k, Point{0.f, 0.f, 0.f});
+  std::vector<int> counts(k, 0);
+  for (int i = 0; i < n; ++i)
+  {
+    int const label = labels_host(i);
+    BOOST_TEST((label >= 0 && label < k));
+    float nearest = distance(points_host(i), centroids_host(label));
+    for (int c = 0; c < k; ++c)
+      nearest = std::min(nearest, distance(points_host(i), centroids_host(c)));
+    BOOST_TEST(distance(points_host(i), centroids_host(label)) == nearest,
+               tt::tolerance(1e-5f));
+    for (int d = 0; d < 3; ++d)
+      sums[label][d] += points_host(i)[d];
+    ++counts[label];
+  }
+  for (int c = 0; c < k; ++c)
+  {
+    if (counts[c] == 0)
+      continue;
+    for (int d = 0; d < 3; ++d)
+      BOOST_TEST(std::abs(centroids_host(c)[d] - sums[c][d] / counts[c]) <
+                 1e-4f);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
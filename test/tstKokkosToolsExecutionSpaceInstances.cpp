@@ -144,6 +144,21 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(bvh_query_execution_space_instance, DeviceType,
             {{{0, 0, 0}}, 2},
         }));
 
+  // spatial predicates with a buffer too small and too large
+  for (int buffer_size : {1, 4})
+  {
+    Kokkos::View<int *, MemorySpace> values("Testing::values", 0);
+    Kokkos::View<int *, MemorySpace> offsets("Testing::offsets", 0);
+    tree.query(exec,
+               makeIntersectsQueries<DeviceType, Box>({
+                   {{{0, 0, 0}}, {{1, 1, 1}}},
+                   {{{0, 0, 0}}, {{1, 1, 1}}},
+               }),
+               values, offsets,
+               ArborX::Experimental::TraversalPolicy().setBufferSize(
+                   buffer_size));
+  }
+
   arborx_test_unset_tools_callbacks();
 }
 
@@ -0,0 +1,121 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+#include "ArborXTest_Cloud.hpp"
+#include "ArborXTest_StdVectorToKokkosView.hpp"
+#include "ArborX_EnableDeviceTypes.hpp" // ARBORX_DEVICE_TYPES
+#include "ArborX_EnableViewComparison.hpp"
+#include <ArborX_LocalOutlierFactor.hpp>
+
+#include "BoostTest_CUDA_clang_workarounds.hpp"
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(LocalOutlierFactor)
+
+namespace tt = boost::test_tools;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(lof_line, DeviceType, ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using MemorySpace = typename DeviceType::memory_space;
+  using Point = ArborX::Point<2>;
+  ExecutionSpace space;
+
+  // Evenly spaced points on a line, and an outlier at the end
+  auto points = ArborXTest::toView<ExecutionSpace>(
+      std::vector<Point>{
+          {0.f, 0.f}, {1.f, 0.f}, {2.f, 0.f}, {3.f, 0.f}, {10.f, 0.f}},
+      "Test::points");
+
+  ArborX::Experimental::LocalOutlierFactor<MemorySpace> lof(space, points, 2);
+
+  // k-distances: 2, 1, 1, 2, 8
+  // mean reachability distances: 3/2, 3/2, 3/2, 3/2, 15/2
+  BOOST_TEST(Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{},
+                                                 lof.k_distances) ==
+                 (std::vector<float>{2.f, 1.f, 1.f, 2.f, 8.f}),
+             tt::per_element());
+  BOOST_TEST(Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{},
+                                                 lof.densities) ==
+                 (std::vector<float>{2.f / 3, 2.f / 3, 2.f / 3, 2.f / 3,
+                                     2.f / 15}),
+             tt::tolerance(1e-5f) << tt::per_element());
+  BOOST_TEST(Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{},
+                                                 lof.scores) ==
+                 (std::vector<float>{1.f, 1.f, 1.f, 1.f, 5.f}),
+             tt::tolerance(1e-5f) << tt::per_element());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(lof_brute_force, DeviceType, ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using MemorySpace = typename DeviceType::memory_space;
+  using Point = ArborX::Point<3>;
+  ExecutionSpace space;
+
+  auto points = ArborXTest::make_random_cloud<Point>(space, 500);
+  int const k = 7;
+
+  ArborX::Experimental::LocalOutlierFactor<MemorySpace> lof(space, points, k);
+
+  auto points_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, points);
+  int const n = points_host.size();
+
+  using ArborX::Details::distance;
+  std::vector<std::vector<int>> neighbors(n);
+  std::vector<float> k_distances(n);
+  for (int i = 0; i < n; ++i)
+  {
+    std::vector<int> others(n);
+    std::iota(others.begin(), others.end(), 0);
+    others.erase(others.begin() + i);
+    std::partial_sort(others.begin(), others.begin() + k, others.end(),
+                      [&](int a, int b) {
+                        return distance(points_host(i), points_host(a)) <
+                               distance(points_host(i), points_host(b));
+                      });
+    neighbors[i].assign(others.begin(), others.begin() + k);
+    k_distances[i] = distance(points_host(i), points_host(others[k - 1]));
+  }
+  std::vector<float> densities(n);
+  for (int i = 0; i < n; ++i)
+  {
+    float sum = 0;
+    for (int j : neighbors[i])
+      sum += std::max(k_distances[j], distance(points_host(i), points_host(j)));
+    densities[i] = k / sum;
+  }
+  std::vector<float> scores(n);
+  for (int i = 0; i < n; ++i)
+  {
+    float sum = 0;
+    for (int j : neighbors[i])
+      sum += densities[j];
+    scores[i] = sum / (k * densities[i]);
+  }
+
+  BOOST_TEST(Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{},
+                                                 lof.k_distances) ==
+                 k_distances,
+             tt::tolerance(1e-5f) << tt::per_element());
+  BOOST_TEST(Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{},
+                                                 lof.densities) == densities,
+             tt::tolerance(1e-4f) << tt::per_element());
+  BOOST_TEST(Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{},
+                                                 lof.scores) == scores,
+             tt::tolerance(1e-4f) << tt::per_element());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,152 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+#include "ArborXTest_Cloud.hpp"
+#include "ArborXTest_StdVectorToKokkosView.hpp"
+#include "ArborX_EnableDeviceTypes.hpp" // ARBORX_DEVICE_TYPES
+#include <ArborX_MeanShift.hpp>
+
+#include "BoostTest_CUDA_clang_workarounds.hpp"
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <set>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(MeanShift)
+
+namespace tt = boost::test_tools;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(mean_shift_separated_clusters, DeviceType,
+                              ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using MemorySpace = typename DeviceType::memory_space;
+  using Point = ArborX::Point<2>;
+  ExecutionSpace space;
+
+  Kokkos::View<int *, MemorySpace> labels("Test::labels", 0);
+  Kokkos::View<Point *, MemorySpace> modes("Test::modes", 0);
+
+  ArborX::Experimental::meanShift(
+      space, Kokkos::View<Point *, MemorySpace>("Test::points", 0), 1.f,
+      labels, modes);
+  BOOST_TEST(labels.size() == 0);
+  BOOST_TEST(modes.size() == 0);
+
+  // Three clusters of four points, centered at (0, 0), (10, 0) and (0, 10)
+  std::vector<Point> points_host;
+  for (auto const &center :
+       std::vector<Point>{{0.f, 0.f}, {10.f, 0.f}, {0.f, 10.f}})
+    for (auto const &offset : std::vector<Point>{
+             {-1.f, 0.f}, {1.f, 0.f}, {0.f, -1.f}, {0.f, 1.f}})
+      points_host.push_back({center[0] + offset[0], center[1] + offset[1]});
+  auto points = ArborXTest::toView<ExecutionSpace>(points_host, "Test::points");
+
+  for (bool bin_seeding : {false, true})
+  {
+    ArborX::Experimental::meanShift(
+        space, points, 3.f, labels, modes,
+        ArborX::Experimental::MeanShift::Parameters().setBinSeeding(
+            bin_seeding));
+
+    auto labels_host =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, labels);
+    auto modes_host =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, modes);
+    BOOST_TEST(labels_host.size() == 12);
+    BOOST_TEST(modes_host.size() == 3);
+
+    // Every seed moves to the center of its cluster in a single step
+    std::set<int> cluster_labels;
+    for (int cluster = 0; cluster < 3; ++cluster)
+    {
+      int const label = labels_host(4 * cluster);
+      for (int i = 4 * cluster; i < 4 * (cluster + 1); ++i)
+        BOOST_TEST(labels_host(i) == label);
+      cluster_labels.insert(label);
+
+      auto const &point = points_host[4 * cluster];
+      BOOST_TEST(modes_host(label)[0] == point[0] + 1.f,
+                 tt::tolerance(1e-6f));
+      BOOST_TEST(modes_host(label)[1] == point[1], tt::tolerance(1e-6f));
+    }
+    BOOST_TEST(cluster_labels.size() == 3);
+  }
+
+  // The Gaussian kernel weighs the points of the other clusters too little to
+  // move the modes, which converge to the centers in several steps
+  ArborX::Experimental::meanShift(
+      space, points, 1.f, labels, modes,
+      ArborX::Experimental::MeanShift::Parameters()
+          .setKernel(ArborX::Experimental::MeanShift::Kernel::gaussian)
+          .setTolerance(1e-5f));
+  auto labels_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, labels);
+  auto modes_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, modes);
+  BOOST_TEST(labels_host.size() == 12);
+  BOOST_TEST(modes_host.size() == 3);
+  for (int cluster = 0; cluster < 3; ++cluster)
+  {
+    int const label = labels_host(4 * cluster);
+    for (int i = 4 * cluster; i < 4 * (cluster + 1); ++i)
+      BOOST_TEST(labels_host(i) == label);
+
+    auto const &point = points_host[4 * cluster];
+    BOOST_TEST(std::abs(modes_host(label)[0] - (point[0] + 1.f)) < 1e-3f);
+    BOOST_TEST(std::abs(modes_host(label)[1] - point[1]) < 1e-3f);
+  }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(mean_shift_random, DeviceType,
+                              ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using MemorySpace = typename DeviceType::memory_space;
+  using Point = ArborX::Point<3>;
+  ExecutionSpace space;
+
+  auto points = ArborXTest::make_random_cloud<Point>(space, 1000);
+  float const bandwidth = 0.2f;
+
+  Kokkos::View<int *, MemorySpace> labels("Test::labels", 0);
+  Kokkos::View<Point *, MemorySpace> modes("Test::modes", 0);
+  int const num_iterations = ArborX::Experimental::meanShift(
+      space, points, bandwidth, labels, modes,
+      ArborX::Experimental::MeanShift::Parameters().setMaxIterations(1000));
+  BOOST_TEST(num_iterations < 1000);
+
+  auto labels_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, labels);
+  auto modes_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, modes);
+  int const n = labels_host.size();
+  int const num_modes = modes_host.size();
+  BOOST_TEST(n == 1000);
+  BOOST_TEST(num_modes > 0);
+
+  // Every cluster has points
+  std::set<int> cluster_labels;
+  for (int i = 0; i < n; ++i)
+  {
+    BOOST_TEST((labels_host(i) >= 0 && labels_host(i) < num_modes));
+    cluster_labels.insert(labels_host(i));
+  }
+  BOOST_TEST((int)cluster_labels.size() == num_modes);
+
+  // The modes of different clusters were not merged
+  using ArborX::Details::distance;
+  for (int a = 0; a < num_modes; ++a)
+    for (int b = a + 1; b < num_modes; ++b)
+      BOOST_TEST(distance(modes_host(a), modes_host(b)) > bandwidth / 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,196 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include "ArborX_EnableDeviceTypes.hpp" // ARBORX_DEVICE_TYPES
+#include <ArborX_BruteForce.hpp>
+#include <ArborX_LinearBVH.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <string_view>
+
+BOOST_AUTO_TEST_SUITE(MemoryFootprint)
+
+namespace
+{
+
+// Memory allocated by ArborX, the sort it relies on, and the outputs of the
+// queries since the tracker was created. The callbacks of a loaded tools
+// library are forwarded to, and restored afterwards.
+struct MemoryTracker
+{
+  static inline std::int64_t current = 0;
+  static inline std::int64_t peak = 0;
+  static inline Kokkos::Tools::allocateDataFunction previous_allocate =
+      nullptr;
+  static inline Kokkos::Tools::deallocateDataFunction previous_deallocate =
+      nullptr;
+
+  static bool tracked(char const *label)
+  {
+    std::string_view const sv(label);
+    return sv.rfind("ArborX::", 0) == 0 ||
+           sv.rfind("Kokkos::SortImpl::", 0) == 0 ||
+           sv.rfind("Testing::", 0) == 0;
+  }
+
+  MemoryTracker()
+  {
+    current = 0;
+    peak = 0;
+    auto const callbacks = Kokkos::Tools::Experimental::get_callbacks();
+    previous_allocate = callbacks.allocate_data;
+    previous_deallocate = callbacks.deallocate_data;
+    Kokkos::Tools::Experimental::set_allocate_data_callback(
+        [](Kokkos::Profiling::SpaceHandle handle, char const *label,
+           void const *ptr, std::uint64_t size) {
+          if (previous_allocate)
+            previous_allocate(handle, label, ptr, size);
+          if (!tracked(label))
+            return;
+          current += size;
+          peak = std::max(peak, current);
+        });
+    Kokkos::Tools::Experimental::set_deallocate_data_callback(
+        [](Kokkos::Profiling::SpaceHandle handle, char const *label,
+           void const *ptr, std::uint64_t size) {
+          if (previous_deallocate)
+            previous_deallocate(handle, label, ptr, size);
+          if (tracked(label))
+            current -= size;
+        });
+  }
+
+  ~MemoryTracker()
+  {
+    Kokkos::Tools::Experimental::set_allocate_data_callback(previous_allocate);
+    Kokkos::Tools::Experimental::set_deallocate_data_callback(
+        previous_deallocate);
+  }
+};
+
+template <typename ExecutionSpace, typename MemorySpace>
+auto makeGridPoints(ExecutionSpace const &space, int n)
+{
+  Kokkos::View<ArborX::Point<3> *, MemorySpace> points(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing,
+                         "Testing::points"),
+      n * n * n);
+  Kokkos::parallel_for(
+      "Testing::fill_points", Kokkos::RangePolicy(space, 0, n * n * n),
+      KOKKOS_LAMBDA(int i) {
+        points(i) = {(float)(i % n), (float)((i / n) % n),
+                     (float)(i / (n * n))};
+      });
+  return points;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(bvh_construction, DeviceType,
+                              ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using MemorySpace = typename DeviceType::memory_space;
+  using Tree = ArborX::BoundingVolumeHierarchy<MemorySpace, ArborX::Point<3>>;
+
+  ExecutionSpace space;
+
+  BOOST_TEST(Tree().memory_footprint() == 0u);
+  BOOST_TEST(Tree::construction_memory_estimate(0) == 0u);
+
+  for (int n : {2, 5, 10})
+  {
+    auto points = makeGridPoints<ExecutionSpace, MemorySpace>(space, n);
+
+    MemoryTracker tracker;
+    Tree tree(space, points);
+    space.fence();
+
+    BOOST_TEST(tree.memory_footprint() > 0u);
+    BOOST_TEST(tree.memory_footprint() == (std::size_t)MemoryTracker::current);
+    BOOST_TEST((std::size_t)MemoryTracker::peak <=
+               Tree::construction_memory_estimate(tree.size()));
+    BOOST_TEST(tree.memory_footprint() <=
+               Tree::construction_memory_estimate(tree.size()));
+  }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(bvh_queries, DeviceType, ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using MemorySpace = typename DeviceType::memory_space;
+  using Point = ArborX::Point<3>;
+  using Tree = ArborX::BoundingVolumeHierarchy<MemorySpace, Point>;
+
+  ExecutionSpace space;
+
+  int const n = 10;
+  auto points = makeGridPoints<ExecutionSpace, MemorySpace>(space, n);
+  Tree tree(space, points);
+  int const num_queries = points.size();
+
+  using ArborX::Experimental::TraversalPolicy;
+  for (auto const &policy :
+       {TraversalPolicy(), TraversalPolicy().setBufferSize(30),
+        TraversalPolicy().setBufferSize(2),
+        TraversalPolicy().setPredicateSorting(false)})
+  {
+    Kokkos::View<Point *, MemorySpace> values("Testing::values", 0);
+    Kokkos::View<int *, MemorySpace> offsets("Testing::offsets", 0);
+
+    MemoryTracker tracker;
+    tree.query(space, ArborX::Experimental::make_intersects(points, 1.5f),
+               values, offsets, policy);
+    space.fence();
+
+    BOOST_TEST((int)values.size() > num_queries);
+    BOOST_TEST((std::size_t)MemoryTracker::peak <=
+               Tree::spatial_query_memory_estimate(num_queries, values.size(),
+                                                   policy));
+  }
+
+  for (auto const &policy :
+       {TraversalPolicy(), TraversalPolicy().setPredicateSorting(false)})
+  {
+    int const k = 5;
+    Kokkos::View<Point *, MemorySpace> values("Testing::values", 0);
+    Kokkos::View<int *, MemorySpace> offsets("Testing::offsets", 0);
+
+    MemoryTracker tracker;
+    tree.query(space, ArborX::Experimental::make_nearest(points, k), values,
+               offsets, policy);
+    space.fence();
+
+    BOOST_TEST((int)values.size() == num_queries * k);
+    BOOST_TEST((std::size_t)MemoryTracker::peak <=
+               Tree::nearest_query_memory_estimate(num_queries, k, policy));
+  }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(brute_force, DeviceType, ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using MemorySpace = typename DeviceType::memory_space;
+  using Point = ArborX::Point<3>;
+  using Tree = ArborX::BruteForce<MemorySpace, Point>;
+
+  ExecutionSpace space;
+
+  BOOST_TEST(Tree().memory_footprint() == 0u);
+
+  auto points = makeGridPoints<ExecutionSpace, MemorySpace>(space, 4);
+  Tree tree(space, points);
+  BOOST_TEST(tree.memory_footprint() == points.size() * sizeof(Point));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -28,6 +28,10 @@
 #include "BoostTest_CUDA_clang_workarounds.hpp"
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 namespace Test
 {
 using ArborXTest::toView;
@@ -179,3 +183,75 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(
           Test::compute_reference<MemorySpace>(exec_space, points, radius),
       boost::test_tools::per_element());
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(find_k_nearest_neighbor_graph, DeviceType,
+                              ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  ExecutionSpace exec_space;
+
+  using Point = ArborX::Point<3>;
+  auto points = ArborXTest::make_random_cloud<Point>(exec_space, 300);
+  int const k = 7;
+
+  Kokkos::View<int *, ExecutionSpace> offsets("Test::offsets", 0);
+  Kokkos::View<int *, ExecutionSpace> indices("Test::indices", 0);
+  Kokkos::View<float *, ExecutionSpace> distances("Test::distances", 0);
+  ArborX::Experimental::findKNearestNeighborGraph(exec_space, points, k,
+                                                  offsets, indices, distances);
+
+  auto points_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, points);
+  auto offsets_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, offsets);
+  auto indices_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, indices);
+  auto distances_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, distances);
+
+  int const n = points_host.size();
+  BOOST_TEST((int)offsets_host.size() == n + 1);
+  for (int i = 0; i <= n; ++i)
+    BOOST_TEST(offsets_host(i) == i * k);
+
+  // Brute force reference, sorted by distance
+  std::vector<int> reference_indices;
+  std::vector<float> reference_distances;
+  for (int i = 0; i < n; ++i)
+  {
+    std::vector<std::pair<float, int>> candidates;
+    for (int j = 0; j < n; ++j)
+      if (j != i)
+        candidates.emplace_back(
+            ArborX::Details::distance(points_host(i), points_host(j)), j);
+    std::partial_sort(candidates.begin(), candidates.begin() + k,
+                      candidates.end());
+    for (int m = 0; m < k; ++m)
+    {
+      reference_distances.push_back(candidates[m].first);
+      reference_indices.push_back(candidates[m].second);
+    }
+  }
+  std::vector<int> graph_indices(indices_host.data(),
+                                 indices_host.data() + indices_host.size());
+  std::vector<float> graph_distances(
+      distances_host.data(), distances_host.data() + distances_host.size());
+  BOOST_TEST(graph_indices == reference_indices,
+             boost::test_tools::per_element());
+  BOOST_TEST(graph_distances == reference_distances,
+             boost::test_tools::tolerance(1e-6f)
+                 << boost::test_tools::per_element());
+
+  // k is reduced to the number of other points
+  auto two_points = ArborXTest::toView<ExecutionSpace>(
+      std::vector<Point>{{0.f, 0.f, 0.f}, {1.f, 0.f, 0.f}}, "Test::two_points");
+  ArborX::Experimental::findKNearestNeighborGraph(exec_space, two_points, k,
+                                                  offsets, indices, distances);
+  BOOST_TEST(
+      make_compressed_storage(
+          Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, offsets),
+          Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, indices)) ==
+          make_compressed_storage(std::vector<int>{0, 1, 2},
+                                  std::vector<int>{1, 0}),
+      boost::test_tools::per_element());
+}
@@ -0,0 +1,211 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include "ArborXTest_Cloud.hpp"
+#include "ArborXTest_StdVectorToKokkosView.hpp"
+#include "ArborX_EnableDeviceTypes.hpp" // ARBORX_DEVICE_TYPES
+#include <detail/ArborX_PointSetDistances.hpp>
+#include <detail/ArborX_PredicateHelpers.hpp>
+
+#include "BoostTest_CUDA_clang_workarounds.hpp"
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(PointSetDistances)
+
+namespace tt = boost::test_tools;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(point_set_distances, DeviceType,
+                              ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using Point = ArborX::Point<2>;
+  ExecutionSpace exec_space;
+
+  auto points1 = ArborXTest::toView<ExecutionSpace>(
+      std::vector<Point>{{0.f, 0.f}, {1.f, 0.f}, {4.5f, 0.f}}, "Test::points1");
+  auto points2 = ArborXTest::toView<ExecutionSpace>(
+      std::vector<Point>{{0.f, 2.5f}, {3.f, 0.f}}, "Test::points2");
+
+  auto const closest_pair =
+      ArborX::Experimental::closestPair(exec_space, points1, points2);
+  BOOST_TEST(closest_pair.first == 2);
+  BOOST_TEST(closest_pair.second == 1);
+  BOOST_TEST(closest_pair.distance == 1.5f);
+
+  // Distances from points1 to points2: 2.5, 2, 1.5
+  // Distances from points2 to points1: 2.5, 1.5
+  BOOST_TEST(ArborX::Experimental::directedHausdorffDistance(
+                 exec_space, points1, points2) == 2.5f);
+  BOOST_TEST(ArborX::Experimental::directedHausdorffDistance(
+                 exec_space, points2, points1) == 2.5f);
+  BOOST_TEST(ArborX::Experimental::hausdorffDistance(exec_space, points1,
+                                                     points2) == 2.5f);
+  BOOST_TEST(ArborX::Experimental::chamferDistance(exec_space, points1,
+                                                   points2) == 4.f,
+             tt::tolerance(1e-6f));
+
+  // A single point in each set
+  auto point = ArborXTest::toView<ExecutionSpace>(
+      std::vector<Point>{{3.f, 4.f}}, "Test::point");
+  auto origin = ArborXTest::toView<ExecutionSpace>(
+      std::vector<Point>{{0.f, 0.f}}, "Test::origin");
+  BOOST_TEST(ArborX::Experimental::hausdorffDistance(exec_space, point,
+                                                     origin) == 5.f);
+  BOOST_TEST(
+      ArborX::Experimental::closestPair(exec_space, point, origin).distance ==
+      5.f);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(point_set_distances_brute_force, DeviceType,
+                              ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using Point = ArborX::Point<3>;
+  ExecutionSpace exec_space;
+
+  auto points1 = ArborXTest::make_random_cloud<Point>(exec_space, 300);
+  auto points2 = ArborXTest::make_random_cloud<Point>(exec_space, 200, 1.5f,
+                                                      1.f, 1.f, /*seed*/ 1);
+
+  auto points1_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, points1);
+  auto points2_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, points2);
+  int const n1 = points1_host.size();
+  int const n2 = points2_host.size();
+
+  using ArborX::Details::distance;
+  float closest = std::numeric_limits<float>::max();
+  int closest_first = -1;
+  int closest_second = -1;
+  std::vector<float> nearest1(n1, std::numeric_limits<float>::max());
+  std::vector<float> nearest2(n2, std::numeric_limits<float>::max());
+  for (int i = 0; i < n1; ++i)
+    for (int j = 0; j < n2; ++j)
+    {
+      auto const d = distance(points1_host(i), points2_host(j));
+      nearest1[i] = std::min(nearest1[i], d);
+      nearest2[j] = std::min(nearest2[j], d);
+      if (d < closest)
+      {
+        closest = d;
+        closest_first = i;
+        closest_second = j;
+      }
+    }
+  float const hausdorff12 = *std::max_element(nearest1.begin(), nearest1.end());
+  float const hausdorff21 = *std::max_element(nearest2.begin(), nearest2.end());
+  float sum1 = 0;
+  for (auto d : nearest1)
+    sum1 += d;
+  float sum2 = 0;
+  for (auto d : nearest2)
+    sum2 += d;
+
+  auto const closest_pair =
+      ArborX::Experimental::closestPair(exec_space, points1, points2);
+  BOOST_TEST(closest_pair.first == closest_first);
+  BOOST_TEST(closest_pair.second == closest_second);
+  BOOST_TEST(closest_pair.distance == closest);
+  BOOST_TEST(ArborX::Experimental::directedHausdorffDistance(
+                 exec_space, points1, points2) == hausdorff12);
+  BOOST_TEST(ArborX::Experimental::directedHausdorffDistance(
+                 exec_space, points2, points1) == hausdorff21);
+  BOOST_TEST(ArborX::Experimental::hausdorffDistance(exec_space, points1,
+                                                     points2) ==
+             std::max(hausdorff12, hausdorff21));
+  BOOST_TEST(ArborX::Experimental::chamferDistance(exec_space, points1,
+                                                   points2) ==
+                 sum1 / n1 + sum2 / n2,
+             tt::tolerance(1e-4f));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(farthest_brute_force, DeviceType,
+                              ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using MemorySpace = typename DeviceType::memory_space;
+  using Point = ArborX::Point<3>;
+  ExecutionSpace exec_space;
+
+  auto points = ArborXTest::make_random_cloud<Point>(exec_space, 500);
+  auto queries = ArborXTest::make_random_cloud<Point>(exec_space, 20, 2.f, 2.f,
+                                                      2.f, /*seed*/ 1);
+  int const k = 3;
+
+  ArborX::BoundingVolumeHierarchy const bvh(
+      exec_space, ArborX::Experimental::attach_indices(points));
+  Kokkos::View<ArborX::PairValueIndex<Point> *, MemorySpace> values(
+      "Test::values", 0);
+  Kokkos::View<int *, MemorySpace> offsets("Test::offsets", 0);
+  bvh.query(exec_space, ArborX::Experimental::make_farthest(queries, k),
+            values, offsets);
+
+  auto points_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, points);
+  auto queries_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, queries);
+  auto values_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, values);
+  auto offsets_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, offsets);
+  int const n = points_host.size();
+  int const m = queries_host.size();
+
+  using ArborX::Details::distance;
+  for (int q = 0; q < m; ++q)
+  {
+    std::vector<int> indices(n);
+    for (int i = 0; i < n; ++i)
+      indices[i] = i;
+    std::partial_sort(indices.begin(), indices.begin() + k, indices.end(),
+                      [&](int i, int j) {
+                        return distance(queries_host(q), points_host(i)) >
+                               distance(queries_host(q), points_host(j));
+                      });
+    std::vector<int> farthest;
+    for (int j = offsets_host(q); j < offsets_host(q + 1); ++j)
+      farthest.push_back(values_host(j).index);
+    // Results are sorted by decreasing distance
+    BOOST_TEST(farthest == std::vector<int>(indices.begin(),
+                                            indices.begin() + k),
+               tt::per_element());
+  }
+
+  // The double sweep finds the diameter of points along a line
+  auto line = ArborXTest::toView<ExecutionSpace>(
+      std::vector<Point>{
+          {1.f, 0.f, 0.f}, {-2.f, 0.f, 0.f}, {0.f, 0.f, 0.f}, {4.f, 0.f, 0.f}},
+      "Test::line");
+  auto const line_diameter =
+      ArborX::Experimental::approximateDiameter(exec_space, line);
+  BOOST_TEST(std::min(line_diameter.first, line_diameter.second) == 1);
+  BOOST_TEST(std::max(line_diameter.first, line_diameter.second) == 3);
+  BOOST_TEST(line_diameter.distance == 6.f);
+
+  float diameter = 0;
+  for (int i = 0; i < n; ++i)
+    for (int j = 0; j < i; ++j)
+      diameter = std::max(diameter, distance(points_host(i), points_host(j)));
+  auto const approximation =
+      ArborX::Experimental::approximateDiameter(exec_space, points);
+  BOOST_TEST(approximation.distance <= diameter);
+  BOOST_TEST(approximation.distance >= diameter / 2);
+  BOOST_TEST(approximation.distance ==
+             distance(points_host(approximation.first),
+                      points_host(approximation.second)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
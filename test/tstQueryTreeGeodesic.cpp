@@ -0,0 +1,85 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include "ArborXTest_StdVectorToKokkosView.hpp"
+#include "ArborX_EnableDeviceTypes.hpp" // ARBORX_DEVICE_TYPES
+#include <ArborX.hpp>
+#include <ArborXTest_LegacyTree.hpp>
+#include <ArborX_Metrics.hpp>
+#include <ArborX_SphericalCap.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+#include "Search_UnitTestHelpers.hpp"
+
+BOOST_AUTO_TEST_SUITE(Geodesic)
+
+template <typename Tree, typename DeviceType>
+void checkGeodesicQueries()
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using Point = ArborX::Point<3>;
+  using ArborX::Experimental::geographicToCartesian;
+  using ArborX::Experimental::GreatCircle;
+  using ArborX::Experimental::SphericalCap;
+
+  ExecutionSpace exec_space;
+
+  std::vector<Point> points = {
+      geographicToCartesian(0.f, 179.f),  geographicToCartesian(0.f, -179.f),
+      geographicToCartesian(0.f, 170.f),  geographicToCartesian(89.f, 0.f),
+      geographicToCartesian(89.f, 180.f), geographicToCartesian(60.f, 0.f),
+      geographicToCartesian(-45.f, 90.f)};
+  auto const tree = make<Tree>(exec_space, points);
+
+  // Neighbors across the antimeridian and across the pole, which would be
+  // missed by a Euclidean search in the (latitude, longitude) plane
+  std::vector<Point> nearest_points = {geographicToCartesian(0.f, 180.f),
+                                       geographicToCartesian(90.f, 0.f)};
+  ARBORX_TEST_QUERY_TREE(
+      exec_space, tree,
+      ArborX::Experimental::make_nearest(
+          ArborXTest::toView<DeviceType>(nearest_points, "Test::points"), 3,
+          GreatCircle<>{}),
+      make_reference_solution<int>({0, 1, 2, 3, 4, 5}, {0, 3, 6}));
+
+  constexpr float degree = Kokkos::numbers::pi_v<float> / 180;
+  std::vector<SphericalCap<float>> caps = {
+      {geographicToCartesian(0.f, 180.f), 1.5f * degree},
+      {geographicToCartesian(88.f, 90.f), 3.f * degree},
+      {geographicToCartesian(-45.f, 90.f), 0.1f * degree},
+      {geographicToCartesian(-45.f, -90.f), 10.f * degree}};
+  ARBORX_TEST_QUERY_TREE(exec_space, tree,
+                         makeIntersectsQueries<DeviceType>(caps),
+                         make_reference_solution<int>({0, 1, 3, 4, 6},
+                                                      {0, 2, 4, 5, 5}));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(bvh_geodesic, DeviceType, ARBORX_DEVICE_TYPES)
+{
+  using MemorySpace = typename DeviceType::memory_space;
+  using Tree = LegacyTree<ArborX::BoundingVolumeHierarchy<
+      MemorySpace, ArborX::PairValueIndex<ArborX::Point<3>>>>;
+  checkGeodesicQueries<Tree, DeviceType>();
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(brute_force_geodesic, DeviceType,
+                              ARBORX_DEVICE_TYPES)
+{
+  using MemorySpace = typename DeviceType::memory_space;
+  using Tree = LegacyTree<ArborX::BruteForce<
+      MemorySpace, ArborX::PairValueIndex<ArborX::Point<3>>>>;
+  checkGeodesicQueries<Tree, DeviceType>();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
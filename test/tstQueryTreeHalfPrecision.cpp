@@ -0,0 +1,130 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include "ArborX_EnableDeviceTypes.hpp" // ARBORX_DEVICE_TYPES
+#include <ArborX.hpp>
+#include <ArborXTest_LegacyTree.hpp>
+#include <detail/ArborX_SpaceFillingCurves.hpp>
+
+#include <Kokkos_Half.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+#include "Search_UnitTestHelpers.hpp"
+
+BOOST_AUTO_TEST_SUITE(HalfPrecision)
+
+template <typename Coordinate>
+auto makeHalfPoint(float x, float y, float z)
+{
+  return ArborX::Point<3, Coordinate>{{static_cast<Coordinate>(x),
+                                       static_cast<Coordinate>(y),
+                                       static_cast<Coordinate>(z)}};
+}
+
+template <typename MemorySpace>
+struct HalfBVH
+{
+  template <typename Coordinate>
+  using type = LegacyTree<ArborX::BoundingVolumeHierarchy<
+      MemorySpace, ArborX::PairValueIndex<ArborX::Point<3, Coordinate>>>>;
+};
+
+template <typename MemorySpace>
+struct HalfBruteForce
+{
+  template <typename Coordinate>
+  using type = LegacyTree<ArborX::BruteForce<
+      MemorySpace, ArborX::PairValueIndex<ArborX::Point<3, Coordinate>>>>;
+};
+
+template <typename Tree, typename DeviceType, typename Coordinate>
+void checkHalfPrecisionQueries()
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using Point = ArborX::Point<3, Coordinate>;
+  using Box = ArborX::Box<3, Coordinate>;
+
+  ExecutionSpace exec_space;
+
+  // 4x4 grid of points (i, j, 0) with index i + 4 * j
+  std::vector<Point> points;
+  for (int j = 0; j < 4; ++j)
+    for (int i = 0; i < 4; ++i)
+      points.push_back(makeHalfPoint<Coordinate>(i, j, 0));
+  auto const tree = make<Tree>(exec_space, points);
+
+  ARBORX_TEST_QUERY_TREE(
+      exec_space, tree,
+      makeNearestQueries<DeviceType>(
+          {{makeHalfPoint<Coordinate>(1.2f, 1.1f, 0.f), 1},
+           {makeHalfPoint<Coordinate>(2.9f, 0.2f, 0.5f), 2}}),
+      make_reference_solution<int>({5, 3, 7}, {0, 1, 3}));
+
+  ARBORX_TEST_QUERY_TREE(
+      exec_space, tree,
+      makeIntersectsQueries<DeviceType>(
+          std::vector<Box>{{makeHalfPoint<Coordinate>(0.5f, 0.5f, -1.f),
+                            makeHalfPoint<Coordinate>(2.5f, 1.5f, 1.f)},
+                           {makeHalfPoint<Coordinate>(5.f, 5.f, -1.f),
+                            makeHalfPoint<Coordinate>(6.f, 6.f, 1.f)}}),
+      make_reference_solution<int>({5, 6}, {0, 2, 2}));
+}
+
+template <typename DeviceType, template <typename> typename TreeType>
+void checkHalfPrecisionTypes()
+{
+  using Kokkos::Experimental::bhalf_t;
+  using Kokkos::Experimental::half_t;
+  checkHalfPrecisionQueries<TreeType<half_t>, DeviceType, half_t>();
+  checkHalfPrecisionQueries<TreeType<bhalf_t>, DeviceType, bhalf_t>();
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(bvh_half_precision, DeviceType,
+                              ARBORX_DEVICE_TYPES)
+{
+  using MemorySpace = typename DeviceType::memory_space;
+  checkHalfPrecisionTypes<DeviceType, HalfBVH<MemorySpace>::template type>();
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(brute_force_half_precision, DeviceType,
+                              ARBORX_DEVICE_TYPES)
+{
+  using MemorySpace = typename DeviceType::memory_space;
+  checkHalfPrecisionTypes<DeviceType,
+                          HalfBruteForce<MemorySpace>::template type>();
+}
+
+// The normalized coordinates must not be rounded back to half precision,
+// which would only keep about 11 of the 21 bits per dimension of the codes
+BOOST_AUTO_TEST_CASE(half_precision_space_filling_curves)
+{
+  using Kokkos::Experimental::half_t;
+  using ArborX::Experimental::Morton32;
+  using ArborX::Experimental::Morton64;
+
+  // Integers up to 2048 are exact in half precision
+  ArborX::Box<3, half_t> const half_box{
+      makeHalfPoint<half_t>(0.f, 0.f, 0.f),
+      makeHalfPoint<half_t>(2000.f, 2000.f, 2000.f)};
+  ArborX::Box<3> const box{{0.f, 0.f, 0.f}, {2000.f, 2000.f, 2000.f}};
+  for (float x : {1.f, 3.f, 1001.f, 1999.f})
+  {
+    auto const half_point = makeHalfPoint<half_t>(x, 2000.f - x, 777.f);
+    ArborX::Point<3> const point{x, 2000.f - x, 777.f};
+    BOOST_TEST(Morton32{}(half_box, half_point) == Morton32{}(box, point));
+    BOOST_TEST(Morton64{}(half_box, half_point) == Morton64{}(box, point));
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
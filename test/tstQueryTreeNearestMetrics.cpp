@@ -0,0 +1,111 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include "ArborXTest_StdVectorToKokkosView.hpp"
+#include "ArborX_EnableDeviceTypes.hpp" // ARBORX_DEVICE_TYPES
+#include <ArborX.hpp>
+#include <ArborXTest_LegacyTree.hpp>
+#include <ArborX_Metrics.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+#include "Search_UnitTestHelpers.hpp"
+
+BOOST_AUTO_TEST_SUITE(NearestMetrics)
+
+template <typename Tree, typename ExecutionSpace, typename DeviceType,
+          typename Metric>
+void checkNearestMetric(ExecutionSpace const &exec_space, Tree const &tree,
+                        Metric const &metric, std::vector<int> const &expected)
+{
+  using Point = ArborX::Point<2>;
+  std::vector<Point> points = {{0, 0}};
+  ARBORX_TEST_QUERY_TREE(
+      exec_space, tree,
+      ArborX::Experimental::make_nearest(
+          ArborXTest::toView<DeviceType>(points, "Test::query_points"), 2,
+          metric),
+      make_reference_solution<int>(expected, {0, 2}));
+}
+
+template <typename Tree, typename DeviceType>
+void checkNearestMetrics()
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using Point = ArborX::Point<2>;
+  using Box = ArborX::Box<2>;
+
+  ExecutionSpace exec_space;
+
+  // Distances to the origin:
+  //        L1   L2     Linf  L2 (w = 1,4)  L2 (w = 4,1)
+  // 0 :   3.0  3.0    3.0   3.0           6.0
+  // 1 :   4.0  2.828  2.0   4.472         4.472
+  // 2 :   3.5  3.5    3.5   7.0           3.5
+  // 3 :   3.8  2.864  2.6   3.544         5.343
+  // 4 :   4.8  3.394  2.4   5.367         5.367
+  std::vector<Point> points = {{3.f, 0.f},   {2.f, 2.f},   {0.f, 3.5f},
+                               {2.6f, 1.2f}, {2.4f, 2.4f}, {10.f, 10.f},
+                               {-10.f, 5.f}, {0.f, -10.f}};
+  std::vector<Box> boxes;
+  for (auto const &point : points)
+    boxes.emplace_back(point, point);
+  auto const tree = make<Tree>(exec_space, boxes);
+
+  using ArborX::Experimental::Chebyshev;
+  using ArborX::Experimental::Euclidean;
+  using ArborX::Experimental::Farthest;
+  using ArborX::Experimental::Mahalanobis;
+  using ArborX::Experimental::Manhattan;
+  using ArborX::Experimental::WeightedEuclidean;
+
+  checkNearestMetric<Tree, ExecutionSpace, DeviceType>(exec_space, tree,
+                                                       Euclidean{}, {1, 3});
+  checkNearestMetric<Tree, ExecutionSpace, DeviceType>(exec_space, tree,
+                                                       Manhattan{}, {0, 2});
+  checkNearestMetric<Tree, ExecutionSpace, DeviceType>(exec_space, tree,
+                                                       Chebyshev{}, {1, 4});
+  checkNearestMetric<Tree, ExecutionSpace, DeviceType>(
+      exec_space, tree, WeightedEuclidean<2>{1.f, 4.f}, {0, 3});
+  checkNearestMetric<Tree, ExecutionSpace, DeviceType>(
+      exec_space, tree, WeightedEuclidean<2>{4.f, 1.f}, {1, 2});
+  checkNearestMetric<Tree, ExecutionSpace, DeviceType>(
+      exec_space, tree, Mahalanobis<2>{{1.f, 0.f}, {0.f, 4.f}}, {0, 3});
+  // Squared distances: 0 -> 9, 1 -> 0.8, 2 -> 12.25, 3 -> 2.584, 4 -> 1.152,
+  // 5 -> 20
+  checkNearestMetric<Tree, ExecutionSpace, DeviceType>(
+      exec_space, tree, Mahalanobis<2>{{1.f, -0.9f}, {-0.9f, 1.f}}, {1, 4});
+  // Farthest points: 5 -> 14.142, 6 -> 11.180, 7 -> 10
+  checkNearestMetric<Tree, ExecutionSpace, DeviceType>(exec_space, tree,
+                                                       Farthest{}, {5, 6});
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(bvh_nearest_metrics, DeviceType,
+                              ARBORX_DEVICE_TYPES)
+{
+  using MemorySpace = typename DeviceType::memory_space;
+  using Tree = LegacyTree<ArborX::BoundingVolumeHierarchy<
+      MemorySpace, ArborX::PairValueIndex<ArborX::Box<2>>>>;
+  checkNearestMetrics<Tree, DeviceType>();
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(brute_force_nearest_metrics, DeviceType,
+                              ARBORX_DEVICE_TYPES)
+{
+  using MemorySpace = typename DeviceType::memory_space;
+  using Tree = LegacyTree<
+      ArborX::BruteForce<MemorySpace, ArborX::PairValueIndex<ArborX::Box<2>>>>;
+  checkNearestMetrics<Tree, DeviceType>();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
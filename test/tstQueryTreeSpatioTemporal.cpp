@@ -0,0 +1,126 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include "ArborXTest_StdVectorToKokkosView.hpp"
+#include "ArborX_EnableDeviceTypes.hpp" // ARBORX_DEVICE_TYPES
+#include <ArborX.hpp>
+#include <ArborXTest_LegacyTree.hpp>
+#include <ArborX_SpatioTemporal.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+#include "Search_UnitTestHelpers.hpp"
+
+BOOST_AUTO_TEST_SUITE(SpatioTemporal)
+
+using Box4 = ArborX::Box<4>;
+using Sphere = ArborX::Sphere<3>;
+
+// Segments (x, y, z, t) of three trajectories sampled at unit time steps.
+// Segment s of object o has index 10 * o + s.
+//   object 0: moves along x from -5 to 5 during [0, 10]
+//   object 1: stays at (0, 3, 0) during [0, 10]
+//   object 2: moves along y from -5 to 5 during [10, 20]
+inline std::vector<Box4> makeTrajectories()
+{
+  std::vector<Box4> segments;
+  for (int s = 0; s < 10; ++s)
+    segments.push_back({{-5.f + s, 0.f, 0.f, (float)s},
+                        {-4.f + s, 0.f, 0.f, s + 1.f}});
+  for (int s = 0; s < 10; ++s)
+    segments.push_back({{0.f, 3.f, 0.f, (float)s}, {0.f, 3.f, 0.f, s + 1.f}});
+  for (int s = 0; s < 10; ++s)
+    segments.push_back({{0.f, -5.f + s, 0.f, 10.f + s},
+                        {0.f, -4.f + s, 0.f, 11.f + s}});
+  return segments;
+}
+
+template <typename DeviceType>
+auto makeQueries()
+{
+  using ArborX::Experimental::intersects_during;
+  using Predicate = decltype(intersects_during(Sphere{}, 0.f, 0.f));
+  std::vector<Predicate> queries = {
+      intersects_during(Sphere{{0.f, 0.f, 0.f}, 1.f}, 0.f, 20.f),
+      intersects_during(Sphere{{0.f, 0.f, 0.f}, 1.f}, 0.f, 4.5f),
+      intersects_during(Sphere{{0.f, 3.f, 0.f}, 0.5f}, 2.5f, 3.5f),
+      intersects_during(Sphere{{0.f, 0.f, 0.f}, 1.f}, 10.5f, 12.f)};
+  return ArborXTest::toView<DeviceType>(queries, "Test::queries");
+}
+
+inline auto makeReferenceSolution()
+{
+  return make_reference_solution<int>(
+      {3, 4, 5, 6, 23, 24, 25, 26, 3, 4, 12, 13}, {0, 8, 10, 12, 12});
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(bvh_spatio_temporal, DeviceType,
+                              ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using MemorySpace = typename DeviceType::memory_space;
+  using Tree = LegacyTree<ArborX::BoundingVolumeHierarchy<
+      MemorySpace, ArborX::PairValueIndex<Box4>>>;
+
+  ExecutionSpace exec_space;
+  auto const tree = make<Tree>(exec_space, makeTrajectories());
+  ARBORX_TEST_QUERY_TREE(exec_space, tree, makeQueries<DeviceType>(),
+                         makeReferenceSolution());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(brute_force_spatio_temporal, DeviceType,
+                              ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using MemorySpace = typename DeviceType::memory_space;
+  using Tree =
+      LegacyTree<ArborX::BruteForce<MemorySpace, ArborX::PairValueIndex<Box4>>>;
+
+  ExecutionSpace exec_space;
+  auto const tree = make<Tree>(exec_space, makeTrajectories());
+  ARBORX_TEST_QUERY_TREE(exec_space, tree, makeQueries<DeviceType>(),
+                         makeReferenceSolution());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(bvh_time_major_space_filling_curve, DeviceType,
+                              ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using MemorySpace = typename DeviceType::memory_space;
+
+  ExecutionSpace exec_space;
+  auto const segments = ArborXTest::toView<DeviceType>(makeTrajectories(),
+                                                       "Test::segments");
+  ArborX::BoundingVolumeHierarchy const tree(
+      exec_space, ArborX::Experimental::attach_indices(segments),
+      ArborX::Experimental::DefaultIndexableGetter{},
+      ArborX::Experimental::TimeMajorMorton64<>{});
+
+  Kokkos::View<ArborX::PairValueIndex<Box4> *, MemorySpace> values(
+      "Test::values", 0);
+  Kokkos::View<int *, MemorySpace> offsets("Test::offsets", 0);
+  tree.query(exec_space, makeQueries<DeviceType>(), values, offsets);
+
+  auto const values_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, values);
+  std::vector<int> indices(values_host.size());
+  for (int i = 0; i < (int)values_host.size(); ++i)
+    indices[i] = values_host(i).index;
+  BOOST_TEST(make_compressed_storage(
+                 Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{},
+                                                     offsets),
+                 indices) == makeReferenceSolution(),
+             boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,182 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include "ArborX_EnableDeviceTypes.hpp" // ARBORX_DEVICE_TYPES
+#include <ArborX_LinearBVH.hpp>
+#include <ArborX_StreamedQuery.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(StreamedQuery)
+
+namespace tt = boost::test_tools;
+
+namespace
+{
+
+struct IndexOnly
+{
+  template <typename Predicate, typename Value, typename OutputFunctor>
+  KOKKOS_FUNCTION void operator()(Predicate const &, Value const &value,
+                                  OutputFunctor const &out) const
+  {
+    out(value.index);
+  }
+};
+
+// Number of results followed by the sorted indices for each query, since the
+// order of the results is unspecified
+template <typename Values, typename Offsets>
+void appendResults(std::vector<int> &results, Values const &values,
+                   Offsets const &offsets)
+{
+  for (int i = 0; i + 1 < (int)offsets.size(); ++i)
+  {
+    results.push_back(offsets(i + 1) - offsets(i));
+    std::vector<int> indices;
+    for (int j = offsets(i); j < offsets(i + 1); ++j)
+    {
+      if constexpr (std::is_same_v<typename Values::value_type, int>)
+        indices.push_back(values(j));
+      else
+        indices.push_back(values(j).index);
+    }
+    std::sort(indices.begin(), indices.end());
+    results.insert(results.end(), indices.begin(), indices.end());
+  }
+}
+
+// Largest allocation of the host buffers of the streamed query. The callback
+// of a loaded tools library is forwarded to, and restored afterwards.
+struct HostBufferTracker
+{
+  static inline std::uint64_t max_size = 0;
+  static inline Kokkos::Tools::allocateDataFunction previous = nullptr;
+
+  HostBufferTracker()
+  {
+    max_size = 0;
+    previous = Kokkos::Tools::Experimental::get_callbacks().allocate_data;
+    Kokkos::Tools::Experimental::set_allocate_data_callback(
+        [](Kokkos::Profiling::SpaceHandle handle, char const *label,
+           void const *ptr, std::uint64_t size) {
+          if (previous)
+            previous(handle, label, ptr, size);
+          if (std::string_view(label) == "ArborX::StreamedQuery::host_values")
+            max_size = std::max(max_size, size);
+        });
+  }
+
+  ~HostBufferTracker()
+  {
+    Kokkos::Tools::Experimental::set_allocate_data_callback(previous);
+  }
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(streamed_query, DeviceType, ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using MemorySpace = typename DeviceType::memory_space;
+  using Point = ArborX::Point<3>;
+
+  ExecutionSpace space;
+
+  int const n = 10;
+  Kokkos::View<Point *, MemorySpace> points(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "Testing::points"),
+      n * n * n);
+  Kokkos::parallel_for(
+      "Testing::fill_points", Kokkos::RangePolicy(space, 0, n * n * n),
+      KOKKOS_LAMBDA(int i) {
+        points(i) = {(float)(i % n), (float)((i / n) % n),
+                     (float)(i / (n * n))};
+      });
+
+  ArborX::BoundingVolumeHierarchy tree(
+      space, ArborX::Experimental::attach_indices(points));
+  auto const predicates = ArborX::Experimental::make_intersects(points, 1.5f);
+
+  std::vector<int> results_ref;
+  {
+    Kokkos::View<ArborX::PairValueIndex<Point> *, MemorySpace> values(
+        "Testing::values", 0);
+    Kokkos::View<int *, MemorySpace> offsets("Testing::offsets", 0);
+    tree.query(space, predicates, values, offsets);
+    appendResults(
+        results_ref,
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, values),
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, offsets));
+  }
+
+  // 1000 predicates, including a partial last chunk
+  for (int chunk_size : {1000, 300, 64})
+  {
+    std::vector<int> results;
+    int num_chunks = 0;
+    int num_queries = 0;
+    ArborX::Experimental::streamed_query(
+        tree, space, predicates, chunk_size,
+        [&](ExecutionSpace const &instance, int first, auto const &values,
+            auto const &offsets) {
+          BOOST_TEST(first == num_queries);
+          BOOST_TEST((int)offsets.size() <= chunk_size + 1);
+          num_queries += offsets.size() - 1;
+          auto values_host = Kokkos::create_mirror_view(values);
+          auto offsets_host = Kokkos::create_mirror_view(offsets);
+          Kokkos::deep_copy(instance, values_host, values);
+          Kokkos::deep_copy(instance, offsets_host, offsets);
+          instance.fence();
+          appendResults(results, values_host, offsets_host);
+          ++num_chunks;
+        });
+    BOOST_TEST(num_chunks == (n * n * n + chunk_size - 1) / chunk_size);
+    BOOST_TEST(results == results_ref, tt::per_element());
+
+    results.clear();
+    num_queries = 0;
+    std::size_t max_chunk_size = 0;
+    HostBufferTracker tracker;
+    ArborX::Experimental::streamed_query<int>(
+        tree, space, predicates, chunk_size, IndexOnly{},
+        ArborX::Experimental::HostSink{
+            [&](int first, auto const &values, auto const &offsets) {
+              BOOST_TEST(first == num_queries);
+              BOOST_TEST((int)values.size() == offsets(offsets.size() - 1));
+              num_queries += offsets.size() - 1;
+              max_chunk_size = std::max(max_chunk_size, values.size());
+              appendResults(results, values, offsets);
+            }},
+        ArborX::Experimental::TraversalPolicy().setPredicateSorting(false));
+    BOOST_TEST(results == results_ref, tt::per_element());
+    if constexpr (Kokkos::SpaceAccessibility<Kokkos::HostSpace,
+                                             MemorySpace>::accessible)
+    {
+      // The results are handed over without copies
+      BOOST_TEST(HostBufferTracker::max_size == 0u);
+    }
+    else
+    {
+      // The host buffers only grow up to the largest output of a chunk
+      BOOST_TEST(HostBufferTracker::max_size > 0u);
+      BOOST_TEST(HostBufferTracker::max_size <= max_chunk_size * sizeof(int));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -22,6 +22,7 @@
 #include <iostream>
 #include <random>
 #include <tuple>
+#include <vector>
 
 #include "Search_UnitTestHelpers.hpp"
 
@@ -122,6 +123,87 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(buffer_optimization, DeviceType,
       ArborX::query(bvh, ExecutionSpace{}, queries, indices, offset,
                     ArborX::Experimental::TraversalPolicy().setBufferSize(0)));
   checkResultsAreFine();
+
+  // estimated buffer size, from a sample of the predicates
+  BOOST_CHECK_NO_THROW(ArborX::query(
+      bvh, ExecutionSpace{}, queries, indices, offset,
+      ArborX::Experimental::TraversalPolicy().setBufferSizeEstimation(true)));
+  checkResultsAreFine();
+
+  // an explicit buffer size takes precedence over the estimation
+  BOOST_CHECK_THROW(ArborX::query(bvh, ExecutionSpace{}, queries, indices,
+                                  offset,
+                                  ArborX::Experimental::TraversalPolicy()
+                                      .setBufferSizeEstimation(true)
+                                      .setBufferSize(-1)),
+                    ArborX::SearchException);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(buffer_size_estimation, DeviceType,
+                              ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using MemorySpace = typename DeviceType::memory_space;
+
+  using Point = ArborX::Point<3>;
+
+  ExecutionSpace space;
+
+  // Enough points for the estimation to only sample some of the predicates
+  int const n = 16;
+  Kokkos::View<Point *, MemorySpace> points(
+      Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "Testing::points"),
+      n * n * n);
+  Kokkos::parallel_for(
+      "Testing::fill_points", Kokkos::RangePolicy(space, 0, n * n * n),
+      KOKKOS_LAMBDA(int i) {
+        points(i) = {(float)(i % n), (float)((i / n) % n),
+                     (float)(i / (n * n))};
+      });
+
+  ArborX::BoundingVolumeHierarchy tree(
+      space, ArborX::Experimental::attach_indices(points));
+
+  auto queryOffsets = [&](float radius,
+                          ArborX::Experimental::TraversalPolicy const &policy) {
+    Kokkos::View<ArborX::PairValueIndex<Point> *, MemorySpace> values(
+        "Testing::values", 0);
+    Kokkos::View<int *, MemorySpace> offsets("Testing::offsets", 0);
+    tree.query(space, ArborX::Experimental::make_intersects(points, radius),
+               values, offsets, policy);
+    auto offsets_host =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, offsets);
+    BOOST_TEST(offsets_host(offsets_host.size() - 1) == (int)values.size());
+    return std::vector<int>(offsets_host.data(),
+                            offsets_host.data() + offsets_host.size());
+  };
+
+  for (float radius : {0.5f, 1.5f, 3.f})
+  {
+    auto const offsets_ref =
+        queryOffsets(radius, ArborX::Experimental::TraversalPolicy());
+    auto const offsets = queryOffsets(
+        radius,
+        ArborX::Experimental::TraversalPolicy().setBufferSizeEstimation(true));
+    BOOST_TEST(offsets == offsets_ref, tt::per_element());
+
+    // The estimate must cover the queries, so that the second pass is not
+    // needed, including the ones that were not sampled
+    auto const predicates =
+        ArborX::Experimental::make_intersects(points, radius);
+    using Predicates = ArborX::Details::AccessValues<decltype(predicates)>;
+    using OutputView =
+        Kokkos::View<ArborX::PairValueIndex<Point> *, MemorySpace>;
+    int const buffer_size =
+        ArborX::Details::CrsGraphWrapperImpl::estimateBufferSize<OutputView>(
+            space, tree, Predicates{predicates},
+            ArborX::Details::DefaultCallback{});
+    int max_count = 0;
+    for (int i = 0; i + 1 < (int)offsets_ref.size(); ++i)
+      max_count = std::max(max_count, offsets_ref[i + 1] - offsets_ref[i]);
+    BOOST_TEST(buffer_size > 0);
+    BOOST_TEST(buffer_size >= max_count);
+  }
 }
 
 BOOST_AUTO_TEST_CASE_TEMPLATE(unsorted_predicates, DeviceType,
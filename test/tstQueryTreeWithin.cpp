@@ -0,0 +1,134 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include "ArborXTest_StdVectorToKokkosView.hpp"
+#include "ArborX_EnableDeviceTypes.hpp" // ARBORX_DEVICE_TYPES
+#include <ArborX.hpp>
+#include <ArborXTest_LegacyTree.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <numeric>
+#include <vector>
+
+#include "Search_UnitTestHelpers.hpp"
+
+BOOST_AUTO_TEST_SUITE(Within)
+
+using Point = ArborX::Point<2>;
+using Box = ArborX::Box<2>;
+using Sphere = ArborX::Sphere<2>;
+
+// 10x10 grid of points, the point (i, j) has index 10 * i + j
+inline std::vector<Box> makeGrid()
+{
+  std::vector<Box> boxes;
+  for (int i = 0; i < 10; ++i)
+    for (int j = 0; j < 10; ++j)
+    {
+      Point const point{(float)i, (float)j};
+      boxes.emplace_back(point, point);
+    }
+  return boxes;
+}
+
+template <typename Tree, typename DeviceType>
+void checkWithin()
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  ExecutionSpace exec_space;
+
+  auto const tree = make<Tree>(exec_space, makeGrid());
+
+  using ArborX::Experimental::within;
+  Box const region{{1.5f, 1.5f}, {4.5f, 3.5f}};
+  Box const domain{{-1.f, -1.f}, {10.f, 10.f}};
+  Box const outside{{10.5f, 0.f}, {12.f, 10.f}};
+  // the box containing the grid only partially
+  Box const overlap{{-1.f, 8.5f}, {10.f, 10.f}};
+  std::vector<decltype(within(Box{}))> box_queries = {
+      within(region), within(domain), within(outside), within(overlap)};
+
+  std::vector<int> all(100);
+  std::iota(all.begin(), all.end(), 0);
+  std::vector<int> expected = {22, 23, 32, 33, 42, 43};
+  expected.insert(expected.end(), all.begin(), all.end());
+  for (int i = 0; i < 10; ++i)
+    expected.push_back(10 * i + 9);
+
+  ARBORX_TEST_QUERY_TREE(
+      exec_space, tree,
+      ArborXTest::toView<DeviceType>(box_queries, "Test::within_boxes"),
+      make_reference_solution(expected, {0, 6, 106, 106, 116}));
+
+  std::vector<decltype(within(Sphere{}))> sphere_queries = {
+      within(Sphere{{0.f, 0.f}, 1.5f}), within(Sphere{{5.f, 5.f}, 1.f}),
+      within(Sphere{{5.f, 5.f}, 20.f})};
+  expected = {0, 1, 10, 11, 45, 54, 55, 56, 65};
+  expected.insert(expected.end(), all.begin(), all.end());
+
+  ARBORX_TEST_QUERY_TREE(
+      exec_space, tree,
+      ArborXTest::toView<DeviceType>(sphere_queries, "Test::within_spheres"),
+      make_reference_solution(expected, {0, 4, 9, 109}));
+}
+
+template <typename Tree, typename DeviceType>
+void checkContains()
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  ExecutionSpace exec_space;
+
+  // overlapping intervals [i, i + 2] x [0, 1]
+  std::vector<Box> boxes;
+  for (int i = 0; i < 5; ++i)
+    boxes.push_back({{(float)i, 0.f}, {i + 2.f, 1.f}});
+  auto const tree = make<Tree>(exec_space, boxes);
+
+  using ArborX::Experimental::contains;
+  std::vector<decltype(contains(Point{}))> point_queries = {
+      contains(Point{2.5f, 0.5f}), contains(Point{0.5f, 0.5f}),
+      contains(Point{2.5f, 1.5f})};
+  ARBORX_TEST_QUERY_TREE(
+      exec_space, tree,
+      ArborXTest::toView<DeviceType>(point_queries, "Test::contains_points"),
+      make_reference_solution<int>({1, 2, 0}, {0, 2, 3, 3}));
+
+  std::vector<decltype(contains(Box{}))> box_queries = {
+      contains(Box{{2.2f, 0.f}, {3.8f, 1.f}}),
+      contains(Box{{3.2f, 0.f}, {4.8f, 1.f}}),
+      contains(Box{{0.f, 0.f}, {6.f, 1.f}})};
+  ARBORX_TEST_QUERY_TREE(
+      exec_space, tree,
+      ArborXTest::toView<DeviceType>(box_queries, "Test::contains_boxes"),
+      make_reference_solution<int>({2, 3}, {0, 1, 2, 2}));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(bvh_within, DeviceType, ARBORX_DEVICE_TYPES)
+{
+  using MemorySpace = typename DeviceType::memory_space;
+  using Tree = LegacyTree<ArborX::BoundingVolumeHierarchy<
+      MemorySpace, ArborX::PairValueIndex<Box>>>;
+  checkWithin<Tree, DeviceType>();
+  checkContains<Tree, DeviceType>();
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(brute_force_within, DeviceType,
+                              ARBORX_DEVICE_TYPES)
+{
+  using MemorySpace = typename DeviceType::memory_space;
+  using Tree =
+      LegacyTree<ArborX::BruteForce<MemorySpace, ArborX::PairValueIndex<Box>>>;
+  checkWithin<Tree, DeviceType>();
+  checkContains<Tree, DeviceType>();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
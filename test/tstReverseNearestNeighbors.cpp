@@ -0,0 +1,123 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+
+#include "ArborXTest_Cloud.hpp"
+#include "ArborXTest_StdVectorToKokkosView.hpp"
+#include "ArborX_EnableDeviceTypes.hpp" // ARBORX_DEVICE_TYPES
+#include <detail/ArborX_ReverseNearestNeighbors.hpp>
+
+#include "BoostTest_CUDA_clang_workarounds.hpp"
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "Search_UnitTestHelpers.hpp"
+
+BOOST_AUTO_TEST_SUITE(ReverseNearestNeighbors)
+
+template <typename ExecutionSpace, typename Data, typename Queries>
+auto queryReverseNearestNeighbors(ExecutionSpace const &exec_space,
+                                  Data const &data, Queries const &queries,
+                                  int k)
+{
+  ArborX::Experimental::ReverseNearestNeighbors rknn(exec_space, data, k);
+  Kokkos::View<int *, ExecutionSpace> indices("Test::indices", 0);
+  Kokkos::View<int *, ExecutionSpace> offsets("Test::offsets", 0);
+  rknn.query(exec_space, queries, indices, offsets);
+  return make_compressed_storage(
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, offsets),
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, indices));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(reverse_nearest_neighbors, DeviceType,
+                              ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using Point = ArborX::Point<2>;
+  ExecutionSpace exec_space;
+
+  // k-th distances:  point  0  1  2  3  10
+  //                  k = 1  1  1  1  1   7
+  //                  k = 2  2  1  1  2   8
+  auto data = ArborXTest::toView<ExecutionSpace>(
+      std::vector<Point>{{0.f, 0.f}, {1.f, 0.f}, {2.f, 0.f}, {3.f, 0.f},
+                         {10.f, 0.f}},
+      "Test::data");
+  auto queries = ArborXTest::toView<ExecutionSpace>(
+      std::vector<Point>{
+          {2.6f, 0.f}, {6.f, 0.f}, {-0.5f, 0.f}, {-1.5f, 0.f}, {20.f, 0.f}},
+      "Test::queries");
+
+  BOOST_TEST(queryReverseNearestNeighbors(exec_space, data, queries, 1) ==
+                 make_reference_solution<int>({2, 3, 4, 0},
+                                              {0, 2, 3, 4, 4, 4}),
+             boost::test_tools::per_element());
+  BOOST_TEST(queryReverseNearestNeighbors(exec_space, data, queries, 2) ==
+                 make_reference_solution<int>({2, 3, 4, 0, 0},
+                                              {0, 2, 3, 4, 5, 5}),
+             boost::test_tools::per_element());
+  // Not enough data points, all of them are reverse neighbors
+  BOOST_TEST(queryReverseNearestNeighbors(exec_space, data, queries, 5) ==
+                 make_reference_solution<int>(
+                     {0, 1, 2, 3, 4, 0, 1, 2, 3, 4, 0, 1, 2, 3, 4,
+                      0, 1, 2, 3, 4, 0, 1, 2, 3, 4},
+                     {0, 5, 10, 15, 20, 25}),
+             boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(reverse_nearest_neighbors_brute_force,
+                              DeviceType, ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using Point = ArborX::Point<3>;
+  ExecutionSpace exec_space;
+
+  auto data = ArborXTest::make_random_cloud<Point>(exec_space, 200);
+  auto queries = ArborXTest::make_random_cloud<Point>(exec_space, 50, 1.f, 1.f,
+                                                      1.f, /*seed*/ 1);
+  int const k = 4;
+
+  auto data_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, data);
+  auto queries_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, queries);
+  int const n = data_host.size();
+  int const m = queries_host.size();
+
+  using ArborX::Details::distance;
+  std::vector<float> k_distances(n);
+  for (int i = 0; i < n; ++i)
+  {
+    std::vector<float> d;
+    for (int j = 0; j < n; ++j)
+      if (j != i)
+        d.push_back(distance(data_host(i), data_host(j)));
+    std::nth_element(d.begin(), d.begin() + k - 1, d.end());
+    k_distances[i] = d[k - 1];
+  }
+  std::vector<int> offsets_ref = {0};
+  std::vector<int> indices_ref;
+  for (int q = 0; q < m; ++q)
+  {
+    for (int i = 0; i < n; ++i)
+      if (distance(data_host(i), queries_host(q)) <= k_distances[i])
+        indices_ref.push_back(i);
+    offsets_ref.push_back(indices_ref.size());
+  }
+
+  BOOST_TEST(queryReverseNearestNeighbors(exec_space, data, queries, k) ==
+                 make_reference_solution(indices_ref, offsets_ref),
+             boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
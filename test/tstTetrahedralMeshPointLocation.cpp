@@ -0,0 +1,196 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+#include "ArborXTest_StdVectorToKokkosView.hpp"
+#include "ArborX_EnableDeviceTypes.hpp" // ARBORX_DEVICE_TYPES
+#include "ArborX_EnableViewComparison.hpp"
+#include <detail/ArborX_TetrahedralMeshPointLocation.hpp>
+
+#include "BoostTest_CUDA_clang_workarounds.hpp"
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(TetrahedralMeshPointLocation)
+
+namespace tt = boost::test_tools;
+
+using Point = ArborX::Point<3>;
+
+template <typename ExecutionSpace>
+auto toCellsView(ExecutionSpace const &space, std::vector<int> const &v)
+{
+  using MemorySpace = typename ExecutionSpace::memory_space;
+  Kokkos::View<int *[4], MemorySpace> cells("Test::cells", v.size() / 4);
+  auto cells_host = Kokkos::create_mirror_view(cells);
+  for (int c = 0; c < (int)cells.extent(0); ++c)
+    for (int j = 0; j < 4; ++j)
+      cells_host(c, j) = v[4 * c + j];
+  Kokkos::deep_copy(space, cells, cells_host);
+  return cells;
+}
+
+// Check that the points located inside the unit cube are reconstructed by
+// their barycentric coordinates, and that the others are not located
+template <typename PointCells, typename Barycentric>
+void checkLocation(std::vector<Point> const &vertices,
+                   std::vector<int> const &cells,
+                   std::vector<Point> const &points,
+                   PointCells const &point_cells,
+                   Barycentric const &barycentric)
+{
+  auto point_cells_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, point_cells);
+  auto barycentric_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, barycentric);
+  for (int i = 0; i < (int)points.size(); ++i)
+  {
+    auto const &p = points[i];
+    bool inside = true;
+    bool near_boundary = false;
+    for (int d = 0; d < 3; ++d)
+    {
+      inside = inside && p[d] >= 0 && p[d] <= 1;
+      near_boundary = near_boundary || std::abs(p[d]) < 1e-4f ||
+                      std::abs(p[d] - 1) < 1e-4f;
+    }
+    int const c = point_cells_host(i);
+    if (!near_boundary)
+      BOOST_TEST((c >= 0) == inside);
+    if (c < 0)
+      continue;
+
+    Point reconstructed{0.f, 0.f, 0.f};
+    for (int j = 0; j < 4; ++j)
+    {
+      BOOST_TEST(barycentric_host(i, j) >= -1e-5f);
+      for (int d = 0; d < 3; ++d)
+        reconstructed[d] +=
+            barycentric_host(i, j) * vertices[cells[4 * c + j]][d];
+    }
+    for (int d = 0; d < 3; ++d)
+      BOOST_TEST(reconstructed[d] == p[d], tt::tolerance(1e-4f));
+  }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(single_tetrahedron, DeviceType,
+                              ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using MemorySpace = typename DeviceType::memory_space;
+  ExecutionSpace space;
+
+  ArborX::Experimental::TetrahedralMeshPointLocation<MemorySpace> locator(
+      space,
+      ArborXTest::toView<ExecutionSpace>(
+          std::vector<Point>{{0.f, 0.f, 0.f},
+                             {1.f, 0.f, 0.f},
+                             {0.f, 1.f, 0.f},
+                             {0.f, 0.f, 1.f}},
+          "Test::vertices"),
+      toCellsView(space, {0, 1, 2, 3}));
+
+  auto points = ArborXTest::toView<ExecutionSpace>(
+      std::vector<Point>{{0.1f, 0.2f, 0.3f}, {1.f, 1.f, 1.f}}, "Test::points");
+
+  Kokkos::View<int *, MemorySpace> point_cells("Test::point_cells", 0);
+  Kokkos::View<float *[4], MemorySpace> barycentric("Test::barycentric", 0);
+  locator.locate(space, points, point_cells, barycentric);
+  BOOST_TEST(point_cells == (std::vector<int>{0, -1}), tt::per_element());
+  auto barycentric_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, barycentric);
+  BOOST_TEST(barycentric_host(0, 0) == 0.4f, tt::tolerance(1e-5f));
+  BOOST_TEST(barycentric_host(0, 1) == 0.1f, tt::tolerance(1e-5f));
+  BOOST_TEST(barycentric_host(0, 2) == 0.2f, tt::tolerance(1e-5f));
+  BOOST_TEST(barycentric_host(0, 3) == 0.3f, tt::tolerance(1e-5f));
+
+  // Same results when walking from a guess, or without a guess
+  locator.locate(space, points,
+                 ArborXTest::toView<ExecutionSpace>(std::vector<int>{0, -1},
+                                                    "Test::guesses"),
+                 point_cells, barycentric);
+  BOOST_TEST(point_cells == (std::vector<int>{0, -1}), tt::per_element());
+  barycentric_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, barycentric);
+  BOOST_TEST(barycentric_host(0, 0) == 0.4f, tt::tolerance(1e-5f));
+  BOOST_TEST(barycentric_host(0, 3) == 0.3f, tt::tolerance(1e-5f));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(structured_mesh, DeviceType, ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using MemorySpace = typename DeviceType::memory_space;
+  ExecutionSpace space;
+
+  // Unit cube divided into n^3 cubes, each split into six tetrahedra along
+  // its main diagonal (Kuhn subdivision), which is conforming
+  int const n = 4;
+  auto vertex_index = [n](int i, int j, int k) {
+    return i + (n + 1) * (j + (n + 1) * k);
+  };
+  std::vector<Point> vertices;
+  for (int k = 0; k <= n; ++k)
+    for (int j = 0; j <= n; ++j)
+      for (int i = 0; i <= n; ++i)
+        vertices.push_back({(float)i / n, (float)j / n, (float)k / n});
+  int const permutations[6][3] = {{0, 1, 2}, {0, 2, 1}, {1, 0, 2},
+                                  {1, 2, 0}, {2, 0, 1}, {2, 1, 0}};
+  std::vector<int> cells;
+  for (int k = 0; k < n; ++k)
+    for (int j = 0; j < n; ++j)
+      for (int i = 0; i < n; ++i)
+        for (auto const &permutation : permutations)
+        {
+          int x[3] = {i, j, k};
+          cells.push_back(vertex_index(x[0], x[1], x[2]));
+          for (int d : permutation)
+          {
+            ++x[d];
+            cells.push_back(vertex_index(x[0], x[1], x[2]));
+          }
+        }
+
+  ArborX::Experimental::TetrahedralMeshPointLocation<MemorySpace> locator(
+      space, ArborXTest::toView<ExecutionSpace>(vertices, "Test::vertices"),
+      toCellsView(space, cells));
+
+  std::mt19937 gen(11);
+  std::uniform_real_distribution<float> uniform(-0.1f, 1.1f);
+  std::uniform_real_distribution<float> displacement(-0.05f, 0.05f);
+  std::vector<Point> points;
+  for (int i = 0; i < 1000; ++i)
+    points.push_back({uniform(gen), uniform(gen), uniform(gen)});
+
+  Kokkos::View<int *, MemorySpace> point_cells("Test::point_cells", 0);
+  Kokkos::View<float *[4], MemorySpace> barycentric("Test::barycentric", 0);
+  locator.locate(space, ArborXTest::toView<ExecutionSpace>(points),
+                 point_cells, barycentric);
+  checkLocation(vertices, cells, points, point_cells, barycentric);
+
+  // Move the points slightly, and walk from their previous cells. Some of the
+  // points move in or out of the mesh.
+  for (auto &p : points)
+    for (int d = 0; d < 3; ++d)
+      p[d] += displacement(gen);
+  locator.locate(space, ArborXTest::toView<ExecutionSpace>(points),
+                 point_cells, point_cells, barycentric);
+  checkLocation(vertices, cells, points, point_cells, barycentric);
+
+  // Walk from an arbitrary cell
+  locator.locate(space, ArborXTest::toView<ExecutionSpace>(points),
+                 Kokkos::View<int *, MemorySpace>("Test::guesses", 1000),
+                 point_cells, barycentric);
+  checkLocation(vertices, cells, points, point_cells, barycentric);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,90 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+#include "ArborXTest_StdVectorToKokkosView.hpp"
+#include "ArborX_EnableDeviceTypes.hpp" // ARBORX_DEVICE_TYPES
+#include <ArborX_Box.hpp>
+#include <ArborX_LinearBVH.hpp>
+#include <ArborX_TreeQuality.hpp>
+
+#include "BoostTest_CUDA_clang_workarounds.hpp"
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(TreeQuality)
+
+namespace tt = boost::test_tools;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(tree_quality, DeviceType, ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using MemorySpace = typename DeviceType::memory_space;
+  using Box = ArborX::Box<3>;
+  ExecutionSpace space;
+
+  using ArborX::Experimental::treeQuality;
+
+  auto quality = treeQuality(
+      space, ArborX::BoundingVolumeHierarchy(
+                 space, Kokkos::View<Box *, MemorySpace>("Test::boxes", 0)));
+  BOOST_TEST(quality.sah_cost == 0);
+  BOOST_TEST(quality.level_num_nodes.empty());
+
+  quality = treeQuality(
+      space, ArborX::BoundingVolumeHierarchy(
+                 space, ArborXTest::toView<ExecutionSpace>(
+                            std::vector<Box>{{{0, 0, 0}, {1, 1, 1}}},
+                            "Test::boxes")));
+  BOOST_TEST(quality.sah_cost == 1);
+  BOOST_TEST(quality.epo_cost == 0);
+  BOOST_TEST(quality.max_leaf_depth == 0);
+  BOOST_TEST(quality.level_num_nodes == (std::vector<int>{1}),
+             tt::per_element());
+
+  // Two pairs of overlapping boxes along the x-axis. The tree is balanced,
+  // with surface areas 30 for the root, 14 for the internal nodes, and 10 for
+  // the leaves. Each leaf overlaps its sibling over a unit cube.
+  quality = treeQuality(
+      space, ArborX::BoundingVolumeHierarchy(
+                 space, ArborXTest::toView<ExecutionSpace>(
+                            std::vector<Box>{{{0, 0, 0}, {2, 1, 1}},
+                                             {{1, 0, 0}, {3, 1, 1}},
+                                             {{4, 0, 0}, {6, 1, 1}},
+                                             {{5, 0, 0}, {7, 1, 1}}},
+                            "Test::boxes")));
+  BOOST_TEST(quality.level_num_nodes == (std::vector<int>{1, 2, 4}),
+             tt::per_element());
+  BOOST_TEST(quality.average_leaf_depth == 2);
+  BOOST_TEST(quality.max_leaf_depth == 2);
+  BOOST_TEST(quality.sah_cost == (1.2 * (30 + 14 + 14) + 4 * 10) / 30,
+             tt::tolerance(1e-6));
+  BOOST_TEST(quality.epo_cost == 4 * 6. / 30, tt::tolerance(1e-6));
+  BOOST_TEST(quality.sibling_overlap == 2. / 7, tt::tolerance(1e-6));
+  BOOST_TEST(quality.level_average_area[0] == 1, tt::tolerance(1e-6));
+  BOOST_TEST(quality.level_average_area[1] == 14. / 30, tt::tolerance(1e-6));
+  BOOST_TEST(quality.level_average_area[2] == 10. / 30, tt::tolerance(1e-6));
+
+  // Same hierarchy without overlaps
+  quality = treeQuality(
+      space, ArborX::BoundingVolumeHierarchy(
+                 space, ArborXTest::toView<ExecutionSpace>(
+                            std::vector<Box>{{{0, 0, 0}, {1, 1, 1}},
+                                             {{2, 0, 0}, {3, 1, 1}},
+                                             {{4, 0, 0}, {5, 1, 1}},
+                                             {{6, 0, 0}, {7, 1, 1}}},
+                            "Test::boxes")));
+  BOOST_TEST(quality.level_num_nodes == (std::vector<int>{1, 2, 4}),
+             tt::per_element());
+  BOOST_TEST(quality.epo_cost == 0, tt::tolerance(1e-6));
+  BOOST_TEST(quality.sibling_overlap == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
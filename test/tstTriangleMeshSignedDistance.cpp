@@ -0,0 +1,152 @@
+/****************************************************************************
+ * Copyright (c) 2025, ArborX authors                                       *
+ * All rights reserved.                                                     *
+ *                                                                          *
+ * This file is part of the ArborX library. ArborX is                       *
+ * distributed under a BSD 3-clause license. For the licensing terms see    *
+ * the LICENSE file in the top-level directory.                             *
+ *                                                                          *
+ * SPDX-License-Identifier: BSD-3-Clause                                    *
+ ****************************************************************************/
+#include "ArborXTest_StdVectorToKokkosView.hpp"
+#include "ArborX_EnableDeviceTypes.hpp" // ARBORX_DEVICE_TYPES
+#include "ArborX_EnableViewComparison.hpp"
+#include <detail/ArborX_TriangleMeshSignedDistance.hpp>
+
+#include "BoostTest_CUDA_clang_workarounds.hpp"
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(TriangleMeshSignedDistance)
+
+namespace tt = boost::test_tools;
+
+using Point = ArborX::Point<3>;
+
+// Unit cube [0, 1]^3, with the triangles oriented outwards
+template <typename ExecutionSpace>
+auto makeUnitCube(ExecutionSpace const &space)
+{
+  using MemorySpace = typename ExecutionSpace::memory_space;
+
+  std::vector<Point> vertices;
+  for (int i = 0; i < 8; ++i)
+    vertices.push_back({(float)(i & 1), (float)((i >> 1) & 1),
+                        (float)((i >> 2) & 1)});
+  int const connectivity[12][3] = {{0, 2, 1}, {1, 2, 3}, {4, 5, 6}, {5, 7, 6},
+                                   {0, 1, 4}, {1, 5, 4}, {2, 6, 3}, {3, 6, 7},
+                                   {0, 4, 2}, {2, 4, 6}, {1, 3, 5}, {3, 7, 5}};
+
+  Kokkos::View<int *[3], MemorySpace> triangles("Test::triangles", 12);
+  auto triangles_host = Kokkos::create_mirror_view(triangles);
+  for (int t = 0; t < 12; ++t)
+    for (int j = 0; j < 3; ++j)
+      triangles_host(t, j) = connectivity[t][j];
+  Kokkos::deep_copy(space, triangles, triangles_host);
+
+  return ArborX::Experimental::TriangleMeshSignedDistance<MemorySpace>(
+      space, ArborXTest::toView<ExecutionSpace>(vertices, "Test::vertices"),
+      triangles);
+}
+
+// Exact signed distance to the unit cube
+float cubeSignedDistance(Point const &p)
+{
+  float outside = 0;
+  float inside = 1;
+  for (int d = 0; d < 3; ++d)
+  {
+    float const delta = std::max({-p[d], p[d] - 1, 0.f});
+    outside += delta * delta;
+    inside = std::min({inside, p[d], 1 - p[d]});
+  }
+  return (outside > 0 ? std::sqrt(outside) : -std::max(inside, 0.f));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(unit_cube, DeviceType, ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using MemorySpace = typename DeviceType::memory_space;
+  ExecutionSpace space;
+
+  auto const sdf = makeUnitCube(space);
+
+  // Closest features: face (inside and outside), vertex, edge, and three
+  // faces at once
+  std::vector<Point> points_host = {{0.5f, 0.5f, 0.5f},
+                                    {2.f, 0.5f, 0.5f},
+                                    {1.5f, 1.5f, 1.5f},
+                                    {1.5f, 1.5f, 0.5f},
+                                    {0.9f, 0.9f, 0.9f}};
+  Kokkos::View<float *, MemorySpace> distances("Test::distances", 0);
+  sdf.evaluate(space,
+               ArborXTest::toView<ExecutionSpace>(points_host, "Test::points"),
+               distances);
+  BOOST_TEST(distances == (std::vector<float>{-0.5f, 1.f, std::sqrt(0.75f),
+                                              std::sqrt(0.5f), -0.1f}),
+             tt::tolerance(1e-5f) << tt::per_element());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(unit_cube_random, DeviceType,
+                              ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using MemorySpace = typename DeviceType::memory_space;
+  ExecutionSpace space;
+
+  auto const sdf = makeUnitCube(space);
+
+  std::mt19937 gen(5);
+  std::uniform_real_distribution<float> uniform(-0.5f, 1.5f);
+  std::vector<Point> points_host;
+  std::vector<float> ref;
+  while (points_host.size() < 2000)
+  {
+    Point const p{uniform(gen), uniform(gen), uniform(gen)};
+    // Skip the points too close to the surface for the sign to be robust
+    if (std::abs(cubeSignedDistance(p)) < 1e-4f)
+      continue;
+    points_host.push_back(p);
+    ref.push_back(cubeSignedDistance(p));
+  }
+
+  Kokkos::View<float *, MemorySpace> distances("Test::distances", 0);
+  sdf.evaluate(space,
+               ArborXTest::toView<ExecutionSpace>(points_host, "Test::points"),
+               distances);
+  BOOST_TEST(distances == ref, tt::tolerance(1e-5f) << tt::per_element());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(unit_cube_grid, DeviceType, ARBORX_DEVICE_TYPES)
+{
+  using ExecutionSpace = typename DeviceType::execution_space;
+  using MemorySpace = typename DeviceType::memory_space;
+  ExecutionSpace space;
+
+  auto const sdf = makeUnitCube(space);
+
+  // The grid dimensions are not multiples of the brick size on purpose
+  Point const origin{-0.33f, -0.41f, -0.27f};
+  float const spacing = 0.13f;
+  int const nx = 14;
+  int const ny = 11;
+  int const nz = 13;
+
+  Kokkos::View<float *, MemorySpace> distances("Test::distances", 0);
+  sdf.evaluateOnGrid(space, origin, spacing, nx, ny, nz, distances);
+
+  std::vector<float> ref;
+  for (int k = 0; k < nz; ++k)
+    for (int j = 0; j < ny; ++j)
+      for (int i = 0; i < nx; ++i)
+        ref.push_back(cubeSignedDistance({origin[0] + i * spacing,
+                                          origin[1] + j * spacing,
+                                          origin[2] + k * spacing}));
+  BOOST_TEST(distances == ref, tt::tolerance(1e-5f) << tt::per_element());
+}
+
+BOOST_AUTO_TEST_SUITE_END()